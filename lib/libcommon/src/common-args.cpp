@@ -73,6 +73,41 @@
 
     }
 
+    char * lc_read_nstring( int const argc, char ** argv, char const * const lc_long, char const * const lc_short, int const lc_index ) {
+
+        /* occurrence variable */
+        int lc_count( 0 );
+
+        /* parsing arguments and parameters */
+        for ( int lc_parse( 0 ); lc_parse < argc; lc_parse ++ ) {
+
+            /* check argument short and long forms */
+            if ( ( strcmp( argv[lc_parse], lc_long ) == 0 ) || ( strcmp( argv[lc_parse], lc_short ) == 0 ) ) {
+
+                /* check occurrence */
+                if ( ( lc_count ++ ) == lc_index ) {
+
+                    /* check consistency */
+                    if ( ( ++ lc_parse ) < argc ) {
+
+                        /* return parameter */
+                        return( argv[lc_parse] );
+
+                    /* return default value */
+                    } else { return( nullptr ); }
+
+                }
+
+                /* skip parameter */
+                lc_parse ++;
+
+            }
+
+        /* return default value */
+        } return( nullptr );
+
+    }
+
     intmax_t lc_read_signed( int const argc, char ** argv, char const * const lc_long, char const * const lc_short, intmax_t const lc_default ) {
 
         /* parsing arguments and parameters */
@@ -96,6 +96,25 @@
 
     char * lc_read_string( int const argc, char ** argv, char const * const lc_long, char const * const lc_short );
 
+    /*! \brief arguments and parameters methods
+     *
+     *  This function searches in the provided arguments list the occurrence,
+     *  of the provided index, of the specified argument. This allows arguments
+     *  to be repeated. As it is, the function returns the pointer to the string
+     *  containing the parameter of the found occurrence. The occurrences are
+     *  indexed from zero in the order of the arguments list.
+     *
+     *  \param  argc     Main function parameters
+     *  \param  argv     Main function parameters
+     *  \param  lc_long  Argument string - long form
+     *  \param  lc_short Argument string - short form
+     *  \param  lc_index Index of the occurrence
+     *
+     *  \return Pointer to parameter string on success, NULL otherwise
+     */
+
+    char * lc_read_nstring( int const argc, char ** argv, char const * const lc_long, char const * const lc_short, int const lc_index );
+
     /*! \brief arguments and parameters methods
      *
      *  This function searches in the provided argument list if the specified
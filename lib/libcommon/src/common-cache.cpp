@@ -0,0 +1,227 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "common-cache.hpp"
+
+/*
+    source - constructor/destructor methods
+ */
+
+    lc_cache_t::lc_cache_t( le_char_t const * const lc_path )
+
+        : ch_path( lc_path )
+        , ch_limit( LC_CACHE_LIMIT )
+
+    {
+
+        /* limit structure variable */
+        struct rlimit lc_limit;
+
+        /* retrieve process descriptors limit */
+        if ( getrlimit( RLIMIT_NOFILE, & lc_limit ) == 0 ) {
+
+            /* check process descriptors limit */
+            if ( lc_limit.rlim_cur != RLIM_INFINITY ) {
+
+                /* check process descriptors limit */
+                if ( lc_limit.rlim_cur < ( LC_CACHE_LIMIT + LC_CACHE_RESERVE ) ) {
+
+                    /* update descriptors limit */
+                    ch_limit = ( lc_limit.rlim_cur > ( LC_CACHE_RESERVE + 1 ) ) ? lc_limit.rlim_cur - LC_CACHE_RESERVE : 1;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    lc_cache_t::~lc_cache_t() {
+
+        /* parsing entries */
+        for ( std::list < lc_cache_entry_t >::iterator lc_parse = ch_list.begin(); lc_parse != ch_list.end(); lc_parse ++ ) {
+
+            /* delete descriptor */
+            close( lc_parse->ce_handle );
+
+            /* release buffer memory */
+            delete [] lc_parse->ce_buffer;
+
+        }
+
+    }
+
+/*
+    source - mutator methods
+ */
+
+    le_void_t lc_cache_t::ch_set_record( le_size_t const lc_x, le_size_t const lc_y, le_size_t const lc_z, le_byte_t const * const lc_record ) {
+
+        /* key variable */
+        lc_cache_key_t lc_key = { lc_x, lc_y, lc_z };
+
+        /* retrieve cell entry */
+        lc_cache_entry_t & lc_entry( ch_get_entry( lc_key ) );
+
+        /* check buffer usage */
+        if ( ( lc_entry.ce_size + LE_ARRAY_DATA ) > LC_CACHE_BUFFER ) {
+
+            /* flush buffer */
+            ch_io_flush( lc_entry );
+
+        }
+
+        /* append record to buffer */
+        std::memcpy( lc_entry.ce_buffer + lc_entry.ce_size, lc_record, LE_ARRAY_DATA );
+
+        /* update buffer usage */
+        lc_entry.ce_size += LE_ARRAY_DATA;
+
+    }
+
+    le_void_t lc_cache_t::ch_set_flush( le_void_t ) {
+
+        /* parsing entries */
+        for ( std::list < lc_cache_entry_t >::iterator lc_parse = ch_list.begin(); lc_parse != ch_list.end(); lc_parse ++ ) {
+
+            /* flush buffer */
+            ch_io_flush( * lc_parse );
+
+        }
+
+    }
+
+    lc_cache_entry_t & lc_cache_t::ch_get_entry( lc_cache_key_t const & lc_key ) {
+
+        /* path variable */
+        le_char_t lc_file[_LE_USE_PATH];
+
+        /* entry variable */
+        lc_cache_entry_t lc_entry = { lc_key, -1, nullptr, 0 };
+
+        /* search entry */
+        std::unordered_map < lc_cache_key_t, std::list < lc_cache_entry_t >::iterator, lc_cache_hash_t >::iterator lc_find( ch_map.find( lc_key ) );
+
+        /* check entry */
+        if ( lc_find != ch_map.end() ) {
+
+            /* check entry position */
+            if ( lc_find->second != ch_list.begin() ) {
+
+                /* move entry to front */
+                ch_list.splice( ch_list.begin(), ch_list, lc_find->second );
+
+            }
+
+            /* return entry */
+            return( ch_list.front() );
+
+        }
+
+        /* check cache state */
+        if ( ch_list.size() >= ch_limit ) {
+
+            /* flush least recently used entry */
+            ch_io_flush( ch_list.back() );
+
+            /* delete descriptor */
+            close( ch_list.back().ce_handle );
+
+            /* recycle buffer memory */
+            lc_entry.ce_buffer = ch_list.back().ce_buffer;
+
+            /* remove entry */
+            ch_map.erase( ch_list.back().ce_key );
+
+            /* remove entry */
+            ch_list.pop_back();
+
+        } else {
+
+            /* allocate buffer memory */
+            if ( ( lc_entry.ce_buffer = new ( std::nothrow ) le_byte_t[LC_CACHE_BUFFER] ) == nullptr ) {
+
+                /* send message */
+                throw( LC_ERROR_MEMORY );
+
+            }
+
+        }
+
+        /* compose cell path */
+        sprintf( ( char * ) lc_file, "%s/%+" _LE_SIZE_P "_%+" _LE_SIZE_P "_%+" _LE_SIZE_P ".uv3", ch_path, lc_key.ck_x, lc_key.ck_y, lc_key.ck_z );
+
+        /* create cell descriptor */
+        if ( ( lc_entry.ce_handle = open( ( char * ) lc_file, O_WRONLY | O_CREAT | O_APPEND, 0666 ) ) < 0 ) {
+
+            /* release buffer memory */
+            delete [] lc_entry.ce_buffer;
+
+            /* send message */
+            throw( LC_ERROR_IO_WRITE );
+
+        }
+
+        /* insert entry */
+        ch_list.push_front( lc_entry );
+
+        /* index entry */
+        ch_map[lc_key] = ch_list.begin();
+
+        /* return entry */
+        return( ch_list.front() );
+
+    }
+
+/*
+    source - i/o methods
+ */
+
+    le_void_t lc_cache_t::ch_io_flush( lc_cache_entry_t & lc_entry ) {
+
+        /* writing variable */
+        ssize_t lc_write( 0 );
+
+        /* offset variable */
+        le_size_t lc_offset( 0 );
+
+        /* export buffer content */
+        while ( lc_offset < lc_entry.ce_size ) {
+
+            /* write buffer segment */
+            if ( ( lc_write = write( lc_entry.ce_handle, lc_entry.ce_buffer + lc_offset, lc_entry.ce_size - lc_offset ) ) <= 0 ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+            /* update offset */
+            lc_offset += lc_write;
+
+        }
+
+        /* reset buffer usage */
+        lc_entry.ce_size = 0;
+
+    }
+
@@ -0,0 +1,279 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   common-cache.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *
+     *  dalai-suite - common library - cache
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_CACHE__
+    # define __LC_CACHE__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-error.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <list>
+    # include <unordered_map>
+    # include <cstdio>
+    # include <cstring>
+    # include <cstdint>
+    # include <inttypes.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/resource.h>
+    # include <eratosthene-include.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define cache descriptor buffer size */
+    # define LC_CACHE_BUFFER  ( LE_ARRAY_DATA * 1024 )
+
+    /* define cache descriptor limit */
+    # define LC_CACHE_LIMIT   ( 1024 )
+
+    /* define cache descriptor reserve */
+    # define LC_CACHE_RESERVE ( 32 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_cache_key_t
+     *  \brief cache key structure
+     *
+     *  This structure holds the integer hash triplet identifying a cell of the
+     *  hashed space. It is used as key of the writer cache.
+     *
+     *  \var lc_cache_key_t::ck_x
+     *  Hash value along the first dimension
+     *  \var lc_cache_key_t::ck_y
+     *  Hash value along the second dimension
+     *  \var lc_cache_key_t::ck_z
+     *  Hash value along the third dimension
+     */
+
+    struct lc_cache_key_t {
+
+        le_size_t ck_x;
+        le_size_t ck_y;
+        le_size_t ck_z;
+
+        bool operator == ( lc_cache_key_t const & lc_key ) const {
+
+            /* compare hash triplet */
+            return( ( ck_x == lc_key.ck_x ) && ( ck_y == lc_key.ck_y ) && ( ck_z == lc_key.ck_z ) );
+
+        }
+
+    };
+
+    /*! \struct lc_cache_hash_t
+     *  \brief cache key hashing structure
+     *
+     *  This structure provides the hashing function used by the writer cache
+     *  map to index its keys.
+     */
+
+    struct lc_cache_hash_t {
+
+        std::size_t operator () ( lc_cache_key_t const & lc_key ) const {
+
+            /* compute and return key hash */
+            return( ( lc_key.ck_x * 73856093 ) ^ ( lc_key.ck_y * 19349663 ) ^ ( lc_key.ck_z * 83492791 ) );
+
+        }
+
+    };
+
+    /*! \struct lc_cache_entry_t
+     *  \brief cache entry structure
+     *
+     *  This structure holds an open cell file descriptor along with its private
+     *  memory buffer.
+     *
+     *  \var lc_cache_entry_t::ce_key
+     *  Hash triplet of the cell
+     *  \var lc_cache_entry_t::ce_handle
+     *  Cell file descriptor
+     *  \var lc_cache_entry_t::ce_buffer
+     *  Cell memory buffer
+     *  \var lc_cache_entry_t::ce_size
+     *  Cell memory buffer usage, in bytes
+     */
+
+    struct lc_cache_entry_t {
+
+        lc_cache_key_t ce_key;
+
+        int ce_handle;
+
+        le_byte_t * ce_buffer;
+        le_size_t   ce_size;
+
+    };
+
+    /*! \class lc_cache_t
+     *  \brief writer cache class
+     *
+     *  This class implements a bounded pool of open cell file descriptors used
+     *  by the hashing process to write records in the files of the cells.
+     *
+     *  Each open descriptor comes with its own memory buffer. Records are first
+     *  accumulated in the buffer of their cell, the buffer being flushed in the
+     *  cell file when it is full or when the descriptor is evicted. The amount
+     *  of simultaneously open descriptors is bounded by \b LC_CACHE_LIMIT and
+     *  by the process file descriptors limit. When the bound is reached, the
+     *  least recently used descriptor is evicted.
+     *
+     *  The cell files are always opened in append mode, an evicted cell being
+     *  simply re-opened on its next access. It follows that the content of the
+     *  written files does not depend on the cache state.
+     *
+     *  \var lc_cache_t::ch_path
+     *  Path of the directory containing the cell files
+     *  \var lc_cache_t::ch_limit
+     *  Maximum amount of simultaneously open descriptors
+     *  \var lc_cache_t::ch_list
+     *  Entries list, sorted from most to least recently used
+     *  \var lc_cache_t::ch_map
+     *  Entries map, indexed by cell hash triplet
+     */
+
+    class lc_cache_t {
+
+        private:
+
+            le_char_t const * ch_path;
+
+            le_size_t ch_limit;
+
+            std::list < lc_cache_entry_t > ch_list;
+
+            std::unordered_map < lc_cache_key_t, std::list < lc_cache_entry_t >::iterator, lc_cache_hash_t > ch_map;
+
+        public:
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The constructor initialises the writer cache for the provided cell
+         *  directory. It computes the maximum amount of simultaneously open
+         *  descriptors considering \b LC_CACHE_LIMIT and the process limit on
+         *  open descriptors, keeping \b LC_CACHE_RESERVE descriptors available
+         *  for the rest of the process.
+         *
+         *  \param lc_path Path of the directory containing the cell files
+         */
+
+        lc_cache_t( le_char_t const * const lc_path );
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The destructor closes the remaining open descriptors and releases
+         *  their memory buffers. As it can not report errors, the destructor
+         *  does not flush the buffers. The \b ch_set_flush() method has to be
+         *  called before to ensure all records are written.
+         */
+
+        ~lc_cache_t();
+
+        /*! \brief mutator methods
+         *
+         *  This function appends the provided uv3 record to the cell identified
+         *  by the provided hash triplet. If the cell descriptor is not already
+         *  open, it is created, possibly evicting the least recently used one.
+         *
+         *  \param lc_x      Hash value along the first dimension
+         *  \param lc_y      Hash value along the second dimension
+         *  \param lc_z      Hash value along the third dimension
+         *  \param lc_record uv3 record
+         */
+
+        le_void_t ch_set_record( le_size_t const lc_x, le_size_t const lc_y, le_size_t const lc_z, le_byte_t const * const lc_record );
+
+        /*! \brief mutator methods
+         *
+         *  This function flushes the memory buffers of all the open descriptors
+         *  in their cell files.
+         */
+
+        le_void_t ch_set_flush( le_void_t );
+
+        private:
+
+        /*! \brief mutator methods
+         *
+         *  This function retrieves the entry of the specified cell, moving it
+         *  at the front of the usage list. If the cell is not in the cache, its
+         *  file is opened in append mode and a new entry is created. If the
+         *  cache is full, the least recently used entry is evicted and its
+         *  memory buffer is recycled for the new entry.
+         *
+         *  \param lc_key Cell hash triplet
+         *
+         *  \return Returns the cell entry
+         */
+
+        lc_cache_entry_t & ch_get_entry( lc_cache_key_t const & lc_key );
+
+        /*! \brief i/o methods
+         *
+         *  This function writes the content of the memory buffer of the provided
+         *  entry in its cell file before to reset the buffer usage.
+         *
+         *  \param lc_entry Cell entry
+         */
+
+        le_void_t ch_io_flush( lc_cache_entry_t & lc_entry );
+
+    };
+
+/*
+    header - function prototypes
+ */
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
@@ -25,7 +25,78 @@
     source - filtering methods
  */
 
-    le_void_t lc_filter_homogeneous( le_char_t const * const lc_ipath, std::ofstream & lc_ostream, le_real_t const lc_mean, le_real_t const lc_factor, le_size_t const lc_threshold ) {
+    le_void_t lc_filter_count( le_byte_t const * const lc_buffer, le_size_t const lc_real, le_real_t const lc_select, le_size_t * const lc_count ) {
+
+        /* voxel grid variable */
+        lc_grid_t lc_grid( lc_buffer, lc_real, std::sqrt( lc_select ) );
+
+        /* voxel key variable */
+        lc_cache_key_t lc_key;
+
+        /* voxel key variable */
+        lc_cache_key_t lc_near;
+
+        /* voxel index variable */
+        le_size_t const * lc_index( nullptr );
+
+        /* voxel size variable */
+        le_size_t lc_size( 0 );
+
+        /* buffer pointer variable */
+        le_real_t * lc_uv3p( nullptr );
+
+        /* buffer pointer variable */
+        le_real_t * lc_uv3s( nullptr );
+
+        /* parsing records */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_real; lc_parse ++ ) {
+
+            /* compute buffer pointer */
+            lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse * LE_ARRAY_DATA );
+
+            /* compute record voxel */
+            lc_grid.gd_get_key( lc_uv3p, lc_key );
+
+            /* parsing adjacent voxels */
+            for ( le_size_t lc_voxel( 0 ); lc_voxel < 27; lc_voxel ++ ) {
+
+                /* compute adjacent voxel key */
+                lc_near.ck_x = lc_key.ck_x + ( lc_voxel % 3 ) - 1;
+                lc_near.ck_y = lc_key.ck_y + ( ( lc_voxel / 3 ) % 3 ) - 1;
+                lc_near.ck_z = lc_key.ck_z + ( lc_voxel / 9 ) - 1;
+
+                /* retrieve voxel records */
+                lc_size = lc_grid.gd_get_cell( lc_near, & lc_index );
+
+                /* parsing voxel records - index sorted */
+                for ( le_size_t lc_local( lc_size ); lc_local > 0; lc_local -- ) {
+
+                    /* consider pairs only once */
+                    if ( lc_index[lc_local - 1] <= lc_parse ) break;
+
+                    /* compute buffer pointer */
+                    lc_uv3s = ( le_real_t * ) ( lc_buffer + lc_index[lc_local - 1] * LE_ARRAY_DATA );
+
+                    /* compute and check condition */
+                    if ( lc_geometry_squaredist( lc_uv3p, lc_uv3s ) < lc_select ) {
+
+                        /* update count */
+                        lc_count[lc_parse] ++;
+
+                        /* update count */
+                        lc_count[lc_index[lc_local - 1]] ++;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    le_void_t lc_filter_homogeneous( le_char_t const * const lc_ipath, std::ostream & lc_ostream, le_real_t const lc_mean, le_real_t const lc_factor, le_size_t const lc_threshold ) {
 
         /* stream variable */
         std::fstream lc_istream;
@@ -45,12 +116,6 @@
         /* buffer variable */
         le_size_t * lc_count( nullptr );
 
-        /* buffer pointer variable */
-        le_real_t * lc_uv3p( nullptr );
-
-        /* buffer pointer variable */
-        le_real_t * lc_uv3s( nullptr );
-
         /* create input stream */
         lc_istream.open( ( char * ) lc_ipath, std::ios::in | std::ios::ate | std::ios::binary );
 
@@ -98,38 +163,19 @@
 
         }
 
-        /* parsing stream element */
-        for ( le_size_t lc_parse( 0 ); lc_parse < lc_size; lc_parse += LE_ARRAY_DATA ) {
-
-            /* compute buffer pointer */
-            lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
-
-            /* parsing stream element */
-            for ( le_size_t lc_index( lc_parse + LE_ARRAY_DATA ); lc_index < lc_size; lc_index += LE_ARRAY_DATA ) {
-
-                /* compute buffer pointer */
-                lc_uv3s = ( le_real_t * ) ( lc_buffer + lc_index );
+        /* check condition - no neighbour otherwise */
+        if ( lc_select > 0.0 ) {
 
-                /* compute and check condition */
-                if ( lc_geometry_squaredist( lc_uv3p, lc_uv3s ) < lc_select ) {
-
-                    /* update count */
-                    lc_count[lc_parse/LE_ARRAY_DATA] ++;
-
-                    /* update count */
-                    lc_count[lc_index/LE_ARRAY_DATA] ++;
-
-                }
-
-            }
+            /* neighbour counting */
+            lc_filter_count( lc_buffer, lc_size / LE_ARRAY_DATA, lc_select, lc_count );
 
         }
 
         /* parsing count array */
         for ( le_size_t lc_parse( 0 ); lc_parse < lc_size; lc_parse += LE_ARRAY_DATA ) {
 
-            /* check condition */
-            if ( lc_count[lc_parse/LE_ARRAY_DATA] >= lc_threshold ) {
+            /* check condition - halo records are not exported */
+            if ( ( lc_count[lc_parse/LE_ARRAY_DATA] >= lc_threshold ) && ( lc_buffer[lc_parse + LE_ARRAY_DATA_POSE] != LC_HASH_HALO ) ) {
 
                 /* check index delay */
                 if ( lc_delay < lc_parse ) {
@@ -160,7 +206,7 @@
 
     }
 
-    le_void_t lc_filter_adaptative( le_char_t const * const lc_ipath, std::ofstream & lc_ostream, le_real_t const lc_factor, le_size_t const lc_threshold ) {
+    le_void_t lc_filter_adaptative( le_char_t const * const lc_ipath, std::ostream & lc_ostream, le_real_t const lc_factor, le_size_t const lc_threshold ) {
 
         /* stream variable */
         std::fstream lc_istream;
@@ -168,15 +214,15 @@
         /* condition variable */
         le_real_t lc_select( 0.0 );
 
-        /* distance variable */
-        le_real_t lc_distance( 0.0 );
-
         /* size variable */
         le_size_t lc_size( 0 );
 
         /* size variable */
         le_size_t lc_real( 0 );
 
+        /* size variable */
+        le_size_t lc_core( 0 );
+
         /* index variable */
         le_size_t lc_delay( 0 );
 
@@ -189,12 +235,6 @@
         /* buffer variable */
         le_real_t * lc_mean( nullptr );
 
-        /* buffer pointer variable */
-        le_real_t * lc_uv3p( nullptr );
-
-        /* buffer pointer variable */
-        le_real_t * lc_uv3s( nullptr );
-
         /* create input stream */
         lc_istream.open( ( char * ) lc_ipath, std::ios::in | std::ios::ate | std::ios::binary );
 
@@ -258,87 +298,48 @@
 
         }
 
-        /* parsing stream element */
-        for ( le_size_t lc_parse( 0 ); lc_parse < lc_size; lc_parse += LE_ARRAY_DATA ) {
-
-            /* compute buffer pointer */
-            lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
-
-            /* parsing stream element */
-            for ( le_size_t lc_index( lc_parse + LE_ARRAY_DATA ); lc_index < lc_size; lc_index += LE_ARRAY_DATA ) {
-
-                /* compute buffer pointer */
-                lc_uv3s = ( le_real_t * ) ( lc_buffer + lc_index );
-
-                /* compute distance */
-                lc_distance = lc_geometry_squaredist( lc_uv3p, lc_uv3s );
-
-                /* check distance */
-                if ( lc_distance < lc_mean[lc_parse/LE_ARRAY_DATA] ) {
-
-                    /* update distance */
-                    lc_mean[lc_parse/LE_ARRAY_DATA] = lc_distance;
+        /* create records tree */
+        lc_tree_t lc_tree( lc_buffer, lc_real );
 
-                }
-
-                /* check distance */
-                if ( lc_distance < lc_mean[lc_index/LE_ARRAY_DATA] ) {
-
-                    /* update distance */
-                    lc_mean[lc_index/LE_ARRAY_DATA] = lc_distance;
-
-                }
-
-            }
+        /* parsing records */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_real; lc_parse ++ ) {
 
-        }
+            /* avoid halo records */
+            if ( lc_buffer[lc_parse * LE_ARRAY_DATA + LE_ARRAY_DATA_POSE] == LC_HASH_HALO ) continue;
 
-        /* parsing array */
-        for ( le_size_t lc_parse( 0 ); lc_parse < lc_real; lc_parse ++ ) {
+            /* search nearest neighbour distance */
+            lc_mean[lc_parse] = lc_tree.tr_get_nearest( lc_parse );
 
             /* mean value accumulation */
             lc_select += std::sqrt( lc_mean[lc_parse] );
 
+            /* update records count */
+            lc_core ++;
+
         }
 
         /* compute mean value */
-        lc_select = ( lc_select / le_real_t( lc_real ) );
+        lc_select = ( lc_select / le_real_t( lc_core ) );
 
         /* compute selection condition */
         lc_select = lc_select * lc_select * lc_factor * lc_factor;
 
-        /* parsing stream element */
-        for ( le_size_t lc_parse( 0 ); lc_parse < lc_size; lc_parse += LE_ARRAY_DATA ) {
-
-            /* compute buffer pointer */
-            lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
-
-            /* parsing stream element */
-            for ( le_size_t lc_index( lc_parse + LE_ARRAY_DATA ); lc_index < lc_size; lc_index += LE_ARRAY_DATA ) {
-
-                /* compute buffer pointer */
-                lc_uv3s = ( le_real_t * ) ( lc_buffer + lc_index );
-
-                /* compute and check condition */
-                if ( lc_geometry_squaredist( lc_uv3p, lc_uv3s ) < lc_select ) {
-
-                    /* update count */
-                    lc_count[lc_parse/LE_ARRAY_DATA] ++;
+        /* parsing records */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_real; lc_parse ++ ) {
 
-                    /* update count */
-                    lc_count[lc_index/LE_ARRAY_DATA] ++;
+            /* avoid halo records */
+            if ( lc_buffer[lc_parse * LE_ARRAY_DATA + LE_ARRAY_DATA_POSE] == LC_HASH_HALO ) continue;
 
-                }
-
-            }
+            /* count neighbours */
+            lc_count[lc_parse] = lc_tree.tr_get_count( lc_parse, lc_select );
 
         }
 
         /* parsing count array */
         for ( le_size_t lc_parse( 0 ); lc_parse < lc_size; lc_parse += LE_ARRAY_DATA ) {
 
-            /* check condition */
-            if ( lc_count[lc_parse/LE_ARRAY_DATA] >= lc_threshold ) {
+            /* check condition - halo records are not exported */
+            if ( ( lc_count[lc_parse/LE_ARRAY_DATA] >= lc_threshold ) && ( lc_buffer[lc_parse + LE_ARRAY_DATA_POSE] != LC_HASH_HALO ) ) {
 
                 /* check index delay */
                 if ( lc_delay < lc_parse ) {
@@ -38,6 +38,9 @@
 
     # include "common-error.hpp"
     # include "common-geometry.hpp"
+    # include "common-grid.hpp"
+    # include "common-hash.hpp"
+    # include "common-tree.hpp"
 
 /*
     header - external includes
@@ -72,6 +75,29 @@
     header - function prototypes
  */
 
+    /*! \brief filtering methods
+     *
+     *  This function counts, for each record of the provided uv3 buffer, the
+     *  amount of other records of the buffer that are closer than the square
+     *  root of the provided squared distance. The counts are accumulated in
+     *  the provided array, that has to be initialised by the caller.
+     *
+     *  Instead of comparing each pair of records, the function builds a voxel
+     *  grid (\b lc_grid_t) over the records with a voxel side equal to the
+     *  selection distance. The neighbours of each record are then searched in
+     *  the 27 voxels adjacent to its own voxel only. As in the voxels the
+     *  records index are sorted, each pair is considered only once.
+     *
+     *  The provided squared distance has to be strictly positive.
+     *
+     *  \param lc_buffer uv3 records buffer
+     *  \param lc_real   Amount of records in the buffer
+     *  \param lc_select Squared selection distance
+     *  \param lc_count  Neighbour count array
+     */
+
+    le_void_t lc_filter_count( le_byte_t const * const lc_buffer, le_size_t const lc_real, le_real_t const lc_select, le_size_t * const lc_count );
+
     /*! \brief filtering methods
      *
      *  This filtering function reads the uv3 records provided through the input
@@ -87,7 +113,7 @@
      *  function checks for each element of the model the amount of neighbour
      *  that are closer to the defined threshold. The elements that have at
      *  least \b lc_threshold elements below the condition are kept, the other
-     *  are discarded.
+     *  are discarded. The neighbours are counted using \b lc_filter_count().
      *
      *  This filtering method is called homogeneous because the model provided
      *  through the input stream is assumed to be only a portion of a larger
@@ -96,6 +122,9 @@
      *  result, the applied filtering condition is homogeneous from the entire
      *  model point of view.
      *
+     *  The records typed as \b LC_HASH_HALO (\b lc_hash_halo()) are considered
+     *  as neighbours of the other records but are never exported.
+     *
      *  Note : The implementation of the filtering process does not takes into
      *  account the type of the read records. It is then not suitable for non
      *  point-based models.
@@ -107,7 +136,7 @@
      *  \param lc_threshold Neighbour condition threshold
      */
 
-    le_void_t lc_filter_homogeneous( le_char_t const * const lc_ipath, std::ofstream & lc_ostream, le_real_t const lc_mean, le_real_t const lc_factor, le_size_t const lc_threshold );
+    le_void_t lc_filter_homogeneous( le_char_t const * const lc_ipath, std::ostream & lc_ostream, le_real_t const lc_mean, le_real_t const lc_factor, le_size_t const lc_threshold );
 
     /*! \brief filtering methods
      *
@@ -129,6 +158,10 @@
      *  order to implement a filtering algorithm able to take into account the
      *  local specificities of the model.
      *
+     *  The records typed as \b LC_HASH_HALO (\b lc_hash_halo()) are considered
+     *  as neighbours of the other records but are neither considered in the
+     *  computation of the local minimum distances mean value nor exported.
+     *
      *  Note : The implementation of the filtering process does not takes into
      *  account the type of the read records. It is then not suitable for non
      *  point-based models.
@@ -139,7 +172,7 @@
      *  \param lc_threshold Neighbour condition threshold
      */
 
-    le_void_t lc_filter_adaptative( le_char_t const * const lc_ipath, std::ofstream & lc_ostream, le_real_t const lc_factor, le_size_t const lc_threshold );
+    le_void_t lc_filter_adaptative( le_char_t const * const lc_ipath, std::ostream & lc_ostream, le_real_t const lc_factor, le_size_t const lc_threshold );
 
 /*
     header - inclusion guard
@@ -0,0 +1,177 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "common-grid.hpp"
+
+/*
+    source - constructor/destructor methods
+ */
+
+    lc_grid_t::lc_grid_t( le_byte_t const * const lc_buffer, le_size_t const lc_count, le_real_t const lc_side )
+
+        : gd_side( lc_side * LC_GRID_MARGIN )
+        , gd_index( nullptr )
+
+    {
+
+        /* sorting array variable */
+        std::pair < lc_cache_key_t, le_size_t > * lc_sort( nullptr );
+
+        /* buffer pointer variable */
+        le_real_t * lc_uv3p( nullptr );
+
+        /* cell variable */
+        lc_grid_cell_t lc_cell = { 0, 0 };
+
+        /* initialise grid origin */
+        gd_edge[0] = std::numeric_limits < le_real_t >::max();
+        gd_edge[1] = std::numeric_limits < le_real_t >::max();
+        gd_edge[2] = std::numeric_limits < le_real_t >::max();
+
+        /* parsing records */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
+
+            /* compute buffer pointer */
+            lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse * LE_ARRAY_DATA );
+
+            /* update grid origin */
+            gd_edge[0] = std::min( gd_edge[0], lc_uv3p[0] );
+            gd_edge[1] = std::min( gd_edge[1], lc_uv3p[1] );
+            gd_edge[2] = std::min( gd_edge[2], lc_uv3p[2] );
+
+        }
+
+        /* allocate array memory */
+        if ( ( gd_index = new ( std::nothrow ) le_size_t[lc_count] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* allocate array memory */
+        if ( ( lc_sort = new ( std::nothrow ) std::pair < lc_cache_key_t, le_size_t >[lc_count] ) == nullptr ) {
+
+            /* release array memory */
+            delete [] gd_index;
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* parsing records */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
+
+            /* compute record voxel */
+            gd_get_key( ( le_real_t * ) ( lc_buffer + lc_parse * LE_ARRAY_DATA ), lc_sort[lc_parse].first );
+
+            /* assign record index */
+            lc_sort[lc_parse].second = lc_parse;
+
+        }
+
+        /* sort records by voxel and index */
+        std::sort( lc_sort, lc_sort + lc_count, [] ( std::pair < lc_cache_key_t, le_size_t > const & lc_a, std::pair < lc_cache_key_t, le_size_t > const & lc_b ) {
+
+            /* compare voxel key */
+            if ( lc_a.first.ck_x != lc_b.first.ck_x ) return( lc_a.first.ck_x < lc_b.first.ck_x );
+            if ( lc_a.first.ck_y != lc_b.first.ck_y ) return( lc_a.first.ck_y < lc_b.first.ck_y );
+            if ( lc_a.first.ck_z != lc_b.first.ck_z ) return( lc_a.first.ck_z < lc_b.first.ck_z );
+
+            /* compare record index */
+            return( lc_a.second < lc_b.second );
+
+        } );
+
+        /* parsing sorted records */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
+
+            /* assign sorted index */
+            gd_index[lc_parse] = lc_sort[lc_parse].second;
+
+            /* update cell count */
+            lc_cell.gc_count ++;
+
+            /* detect voxel end */
+            if ( ( ( lc_parse + 1 ) == lc_count ) || ( ( lc_sort[lc_parse + 1].first == lc_sort[lc_parse].first ) == false ) ) {
+
+                /* register voxel */
+                gd_cell[lc_sort[lc_parse].first] = lc_cell;
+
+                /* reset cell */
+                lc_cell.gc_offset = lc_parse + 1, lc_cell.gc_count = 0;
+
+            }
+
+        }
+
+        /* release array memory */
+        delete [] lc_sort;
+
+    }
+
+    lc_grid_t::~lc_grid_t() {
+
+        /* check array */
+        if ( gd_index != nullptr ) {
+
+            /* release array memory */
+            delete [] gd_index;
+
+        }
+
+    }
+
+/*
+    source - accessor methods
+ */
+
+    le_void_t lc_grid_t::gd_get_key( le_real_t const * const lc_pose, lc_cache_key_t & lc_key ) const {
+
+        /* compute voxel key - signed values */
+        lc_key.ck_x = le_size_t( int64_t( std::floor( ( lc_pose[0] - gd_edge[0] ) / gd_side ) ) );
+        lc_key.ck_y = le_size_t( int64_t( std::floor( ( lc_pose[1] - gd_edge[1] ) / gd_side ) ) );
+        lc_key.ck_z = le_size_t( int64_t( std::floor( ( lc_pose[2] - gd_edge[2] ) / gd_side ) ) );
+
+    }
+
+    le_size_t lc_grid_t::gd_get_cell( lc_cache_key_t const & lc_key, le_size_t const ** const lc_index ) const {
+
+        /* search voxel */
+        std::unordered_map < lc_cache_key_t, lc_grid_cell_t, lc_cache_hash_t >::const_iterator lc_find( gd_cell.find( lc_key ) );
+
+        /* check voxel */
+        if ( lc_find == gd_cell.end() ) {
+
+            /* return empty voxel */
+            return( 0 );
+
+        }
+
+        /* assign voxel index array */
+        ( * lc_index ) = gd_index + lc_find->second.gc_offset;
+
+        /* return voxel count */
+        return( lc_find->second.gc_count );
+
+    }
+
@@ -0,0 +1,193 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   common-grid.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *
+     *  dalai-suite - common library - grid
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_GRID__
+    # define __LC_GRID__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-error.hpp"
+    # include "common-cache.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <unordered_map>
+    # include <algorithm>
+    # include <limits>
+    # include <cmath>
+    # include <cstdint>
+    # include <eratosthene-include.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define voxel side enlargement */
+    # define LC_GRID_MARGIN ( 1.0 + 1e-6 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \struct lc_grid_cell_t
+     *  \brief grid cell structure
+     *
+     *  This structure holds the range, in the grid sorted index array, of the
+     *  records contained in a voxel.
+     *
+     *  \var lc_grid_cell_t::gc_offset
+     *  Offset of the first voxel record in the index array
+     *  \var lc_grid_cell_t::gc_count
+     *  Amount of records in the voxel
+     */
+
+    struct lc_grid_cell_t {
+
+        le_size_t gc_offset;
+        le_size_t gc_count;
+
+    };
+
+    /*! \class lc_grid_t
+     *  \brief voxel grid class
+     *
+     *  This class implements a uniform voxel grid built over a buffer of uv3
+     *  records. It is used to restrict neighbourhood searches to the records
+     *  found in the voxels adjacent to a position.
+     *
+     *  The grid does not duplicate the records. It holds an array of records
+     *  index sorted by voxel and a map associating each occupied voxel to its
+     *  range in the index array. In each voxel, the records index are kept in
+     *  increasing order.
+     *
+     *  The voxel side is set as the provided side slightly enlarged by the
+     *  \b LC_GRID_MARGIN factor. This guarantees that two positions closer
+     *  than the provided side are always found in adjacent voxels despite of
+     *  floating point rounding.
+     *
+     *  \var lc_grid_t::gd_side
+     *  Voxel side length
+     *  \var lc_grid_t::gd_edge
+     *  Grid origin, as the minimum of the records coordinates
+     *  \var lc_grid_t::gd_index
+     *  Records index array, sorted by voxel
+     *  \var lc_grid_t::gd_cell
+     *  Occupied voxels map
+     */
+
+    class lc_grid_t {
+
+        private:
+
+            le_real_t gd_side;
+            le_real_t gd_edge[3];
+
+            le_size_t * gd_index;
+
+            std::unordered_map < lc_cache_key_t, lc_grid_cell_t, lc_cache_hash_t > gd_cell;
+
+        public:
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The constructor builds the voxel grid over the provided buffer of uv3
+         *  records. It computes the grid origin, computes the voxel of each
+         *  record, sorts the records index by voxel and builds the voxels map.
+         *
+         *  The provided side has to be strictly positive.
+         *
+         *  \param lc_buffer uv3 records buffer
+         *  \param lc_count  Amount of records in the buffer
+         *  \param lc_side   Voxel side length
+         */
+
+        lc_grid_t( le_byte_t const * const lc_buffer, le_size_t const lc_count, le_real_t const lc_side );
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The destructor releases the grid index array.
+         */
+
+        ~lc_grid_t();
+
+        /*! \brief accessor methods
+         *
+         *  This function computes the key of the voxel containing the provided
+         *  position. The position does not need to be inside the records
+         *  bounding box. The keys components are signed values stored in the
+         *  unsigned key type : adding or subtracting one to a component always
+         *  gives the key of an adjacent voxel.
+         *
+         *  \param lc_pose Position array
+         *  \param lc_key  Voxel key receiving the result
+         */
+
+        le_void_t gd_get_key( le_real_t const * const lc_pose, lc_cache_key_t & lc_key ) const;
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the amount of records contained in the voxel
+         *  identified by the provided key. The pointer to the first records
+         *  index of the voxel, in the sorted index array, is set in the provided
+         *  pointer.
+         *
+         *  \param lc_key   Voxel key
+         *  \param lc_index Pointer receiving the voxel records index array
+         *
+         *  \return Returns the amount of records in the voxel
+         */
+
+        le_size_t gd_get_cell( lc_cache_key_t const & lc_key, le_size_t const ** const lc_index ) const;
+
+    };
+
+/*
+    header - function prototypes
+ */
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
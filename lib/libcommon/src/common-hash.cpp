@@ -25,13 +25,10 @@
     source - hashing methods
  */
 
-    le_void_t lc_hash( std::ifstream & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean ) {
+    le_void_t lc_hash( lc_uv3_t & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean ) {
 
-        /* stream variable */
-        std::ofstream lc_ostream;
-
-        /* path variable */
-        le_char_t lc_file[_LE_USE_PATH];
+        /* writer cache variable */
+        lc_cache_t lc_cache( lc_opath );
 
         /* buffer variable */
         le_byte_t * lc_buffer( nullptr );
@@ -42,7 +39,7 @@
         le_size_t lc_zhash( 0 );
 
         /* reading variable */
-        le_size_t lc_read( 1 );
+        le_size_t lc_read( 0 );
 
         /* parameter variable */
         le_real_t lc_segment( lc_param * lc_mean );
@@ -55,28 +52,209 @@
         le_size_t lc_stack( LE_UV3_POINT );
 
 
-        /* allocate buffer memory */
-        if ( ( lc_buffer = new ( std::nothrow ) le_byte_t[LE_ARRAY_DATA * LE_UV3_CHUNK] ) == nullptr ) {
+        /* reset input stream */
+        lc_istream.uv_set_reset();
+
+        /* stream chunk reading */
+        while ( ( lc_read = lc_istream.uv_get_chunk( & lc_buffer ) ) > 0 ) {
+
+            /* parsing stream chunk */
+            for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
+
+                /* check primitive stack */
+                if ( ( -- lc_stack ) == 0 ) {
+
+                    /* compute buffer pointer */
+                    lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
 
-            /* send message */
-            throw( LC_ERROR_MEMORY );
+                    /* compute hash index */
+                    lc_xhash = floor( lc_uv3p[0] / le_real_t( lc_segment ) );
+                    lc_yhash = floor( lc_uv3p[1] / le_real_t( lc_segment ) );
+                    lc_zhash = floor( lc_uv3p[2] / le_real_t( lc_segment ) );
+
+                    /* update primitive stack */
+                    lc_stack = * ( ( le_byte_t * ) ( lc_uv3p + 3 ) );
+
+                }
+
+                /* export record to cell */
+                lc_cache.ch_set_record( lc_xhash, lc_yhash, lc_zhash, lc_buffer + lc_parse );
+
+            }
 
         }
 
-        /* reset input stream */
-        lc_istream.clear();
+        /* flush cells buffer */
+        lc_cache.ch_set_flush();
+
+    }
+
+    le_void_t lc_hash_halo( lc_uv3_t & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean, le_real_t const lc_halo ) {
+
+        /* writer cache variable */
+        lc_cache_t lc_cache( lc_opath );
+
+        /* buffer variable */
+        le_byte_t * lc_buffer( nullptr );
+
+        /* halo record variable */
+        le_byte_t lc_record[LE_ARRAY_DATA];
+
+        /* hashing variable */
+        le_size_t lc_xhash( 0 );
+        le_size_t lc_yhash( 0 );
+        le_size_t lc_zhash( 0 );
 
-        /* input stream offset to begining */
-        lc_istream.seekg( 0, std::ios::beg );
+        /* cell border distance variable */
+        le_real_t lc_border[3][3];
+
+        /* distance variable */
+        le_real_t lc_distance( 0.0 );
+
+        /* reading variable */
+        le_size_t lc_read( 0 );
+
+        /* parameter variable */
+        le_real_t lc_segment( lc_param * lc_mean );
+
+        /* buffer pointer variable */
+        le_real_t * lc_uv3p( nullptr );
+
+        /* reset input stream */
+        lc_istream.uv_set_reset();
 
         /* stream chunk reading */
-        while ( lc_read > 0 ) {
+        while ( ( lc_read = lc_istream.uv_get_chunk( & lc_buffer ) ) > 0 ) {
+
+            /* parsing stream chunk */
+            for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
+
+                /* compute buffer pointer */
+                lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
+
+                /* check primitive type - halo marked through type */
+                if ( lc_buffer[lc_parse + LE_ARRAY_DATA_POSE] != LE_UV3_POINT ) {
+
+                    /* send message */
+                    throw( LC_ERROR_FORMAT );
+
+                }
+
+                /* compute hash index */
+                lc_xhash = floor( lc_uv3p[0] / le_real_t( lc_segment ) );
+                lc_yhash = floor( lc_uv3p[1] / le_real_t( lc_segment ) );
+                lc_zhash = floor( lc_uv3p[2] / le_real_t( lc_segment ) );
+
+                /* export record to cell */
+                lc_cache.ch_set_record( lc_xhash, lc_yhash, lc_zhash, lc_buffer + lc_parse );
+
+                /* parsing dimensions */
+                for ( le_size_t lc_dim( 0 ); lc_dim < 3; lc_dim ++ ) {
+
+                    /* distance to lower border */
+                    lc_border[lc_dim][0] = lc_uv3p[lc_dim] - floor( lc_uv3p[lc_dim] / lc_segment ) * lc_segment;
+
+                    /* same cell */
+                    lc_border[lc_dim][1] = 0.0;
+
+                    /* distance to upper border */
+                    lc_border[lc_dim][2] = lc_segment - lc_border[lc_dim][0];
+
+                }
+
+                /* compose halo record */
+                std::memcpy( lc_record, lc_buffer + lc_parse, LE_ARRAY_DATA );
+
+                /* assign halo type */
+                lc_record[LE_ARRAY_DATA_POSE] = LC_HASH_HALO;
+
+                /* parsing adjacent cells */
+                for ( le_size_t lc_cell( 0 ); lc_cell < 27; lc_cell ++ ) {
+
+                    /* avoid record cell */
+                    if ( lc_cell == 13 ) continue;
+
+                    /* compute distance to adjacent cell */
+                    lc_distance = lc_border[0][lc_cell % 3] * lc_border[0][lc_cell % 3]
+                                + lc_border[1][( lc_cell / 3 ) % 3] * lc_border[1][( lc_cell / 3 ) % 3]
+                                + lc_border[2][lc_cell / 9] * lc_border[2][lc_cell / 9];
+
+                    /* check halo condition */
+                    if ( lc_distance < lc_halo * lc_halo ) {
+
+                        /* export halo record to adjacent cell */
+                        lc_cache.ch_set_record( lc_xhash + ( lc_cell % 3 ) - 1, lc_yhash + ( ( lc_cell / 3 ) % 3 ) - 1, lc_zhash + ( lc_cell / 9 ) - 1, lc_record );
+
+                    }
+
+                }
+
+            }
+
+        }
 
-            /* read stream chunk */
-            lc_istream.read( ( char * ) lc_buffer, LE_ARRAY_DATA * LE_UV3_CHUNK );
+        /* flush cells buffer */
+        lc_cache.ch_set_flush();
 
-            /* retrieve read byte count */
-            lc_read = lc_istream.gcount();
+    }
+
+    le_void_t lc_hash_bucket( lc_uv3_t & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean, le_size_t const lc_budget ) {
+
+        /* stream variable */
+        std::ofstream lc_ostream;
+
+        /* path variable */
+        le_char_t lc_file[_LE_USE_PATH];
+
+        /* buffer variable */
+        le_byte_t * lc_buffer( nullptr );
+
+        /* buffer variable */
+        le_byte_t * lc_bucket( nullptr );
+
+        /* key variable */
+        lc_cache_key_t lc_key = { 0, 0, 0 };
+
+        /* cells map variable */
+        std::unordered_map < lc_cache_key_t, le_size_t, lc_cache_hash_t > lc_cell;
+
+        /* cells map variable */
+        std::unordered_map < lc_cache_key_t, le_size_t, lc_cache_hash_t > lc_fill;
+
+        /* size variable */
+        le_size_t lc_size( 0 );
+
+        /* offset variable */
+        le_size_t lc_offset( 0 );
+
+        /* reading variable */
+        le_size_t lc_read( 0 );
+
+        /* parameter variable */
+        le_real_t lc_segment( lc_param * lc_mean );
+
+        /* buffer pointer variable */
+        le_real_t * lc_uv3p( nullptr );
+
+        /* primitive stack variable */
+        le_size_t lc_stack( LE_UV3_POINT );
+
+        /* retrieve input stream size */
+        lc_size = lc_istream.uv_get_size();
+
+        /* check memory budget */
+        if ( lc_size > lc_budget ) {
+
+            /* streaming hashing */
+            lc_hash( lc_istream, lc_opath, lc_param, lc_mean ); return;
+
+        }
+
+        /* reset input stream */
+        lc_istream.uv_set_reset();
+
+        /* stream chunk reading */
+        while ( ( lc_read = lc_istream.uv_get_chunk( & lc_buffer ) ) > 0 ) {
 
             /* parsing stream chunk */
             for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
@@ -88,41 +266,108 @@
                     lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
 
                     /* compute hash index */
-                    lc_xhash = floor( lc_uv3p[0] / le_real_t( lc_segment ) );
-                    lc_yhash = floor( lc_uv3p[1] / le_real_t( lc_segment ) );
-                    lc_zhash = floor( lc_uv3p[2] / le_real_t( lc_segment ) );
-
-                    /* compose stream path */
-                    sprintf( ( char * ) lc_file, "%s/%+" _LE_SIZE_P "_%+" _LE_SIZE_P "_%+" _LE_SIZE_P ".uv3", lc_opath, lc_xhash, lc_yhash, lc_zhash );
+                    lc_key.ck_x = floor( lc_uv3p[0] / le_real_t( lc_segment ) );
+                    lc_key.ck_y = floor( lc_uv3p[1] / le_real_t( lc_segment ) );
+                    lc_key.ck_z = floor( lc_uv3p[2] / le_real_t( lc_segment ) );
 
                     /* update primitive stack */
                     lc_stack = * ( ( le_byte_t * ) ( lc_uv3p + 3 ) );
 
                 }
 
-                /* create output stream */
-                lc_ostream.open( ( char * ) lc_file, std::ios::out | std::ios::app | std::ios::binary );
+                /* update cell count */
+                lc_cell[lc_key] += LE_ARRAY_DATA;
 
-                /* check output stream */
-                if ( lc_ostream.is_open() == false ) {
+            }
 
-                    /* send message */
-                    throw( LC_ERROR_IO_WRITE );
+        }
+
+        /* parsing cells */
+        for ( std::unordered_map < lc_cache_key_t, le_size_t, lc_cache_hash_t >::iterator lc_parse = lc_cell.begin(); lc_parse != lc_cell.end(); lc_parse ++ ) {
+
+            /* assign cell offset */
+            lc_fill[lc_parse->first] = lc_offset;
+
+            /* update offset */
+            lc_offset += lc_parse->second;
+
+        }
+
+        /* allocate bucket memory */
+        if ( ( lc_bucket = new ( std::nothrow ) le_byte_t[lc_offset] ) == nullptr ) {
+
+            /* streaming hashing */
+            lc_hash( lc_istream, lc_opath, lc_param, lc_mean ); return;
+
+        }
+
+        /* reset primitive stack */
+        lc_stack = LE_UV3_POINT;
+
+        /* reset input stream */
+        lc_istream.uv_set_reset();
+
+        /* stream chunk reading */
+        while ( ( lc_read = lc_istream.uv_get_chunk( & lc_buffer ) ) > 0 ) {
+
+            /* parsing stream chunk */
+            for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
+
+                /* check primitive stack */
+                if ( ( -- lc_stack ) == 0 ) {
+
+                    /* compute buffer pointer */
+                    lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
+
+                    /* compute hash index */
+                    lc_key.ck_x = floor( lc_uv3p[0] / le_real_t( lc_segment ) );
+                    lc_key.ck_y = floor( lc_uv3p[1] / le_real_t( lc_segment ) );
+                    lc_key.ck_z = floor( lc_uv3p[2] / le_real_t( lc_segment ) );
+
+                    /* update primitive stack */
+                    lc_stack = * ( ( le_byte_t * ) ( lc_uv3p + 3 ) );
 
                 }
 
-                /* export record to stream */
-                lc_ostream.write( ( char * ) ( lc_buffer + lc_parse ), LE_ARRAY_DATA );
+                /* retrieve cell offset */
+                le_size_t & lc_place( lc_fill[lc_key] );
+
+                /* scatter record in bucket */
+                std::memcpy( lc_bucket + lc_place, lc_buffer + lc_parse, LE_ARRAY_DATA );
 
-                /* close output stream */
-                lc_ostream.close();
+                /* update cell offset */
+                lc_place += LE_ARRAY_DATA;
 
             }
 
         }
 
-        /* release buffer memory */
-        delete [] lc_buffer;
+        /* parsing cells */
+        for ( std::unordered_map < lc_cache_key_t, le_size_t, lc_cache_hash_t >::iterator lc_parse = lc_cell.begin(); lc_parse != lc_cell.end(); lc_parse ++ ) {
 
-    }
+            /* compose stream path */
+            sprintf( ( char * ) lc_file, "%s/%+" _LE_SIZE_P "_%+" _LE_SIZE_P "_%+" _LE_SIZE_P ".uv3", lc_opath, lc_parse->first.ck_x, lc_parse->first.ck_y, lc_parse->first.ck_z );
+
+            /* create output stream */
+            lc_ostream.open( ( char * ) lc_file, std::ios::out | std::ios::app | std::ios::binary );
 
+            /* check output stream */
+            if ( lc_ostream.is_open() == false ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+            /* export cell records - filled offset points at cell end */
+            lc_ostream.write( ( char * ) ( lc_bucket + lc_fill[lc_parse->first] - lc_parse->second ), lc_parse->second );
+
+            /* close output stream */
+            lc_ostream.close();
+
+        }
+
+        /* release bucket memory */
+        delete [] lc_bucket;
+
+    }
@@ -37,13 +37,17 @@
  */
 
     # include "common-error.hpp"
+    # include "common-uv3.hpp"
+    # include "common-cache.hpp"
 
 /*
     header - external includes
  */
 
     # include <fstream>
+    # include <unordered_map>
     # include <cmath>
+    # include <cstring>
     # include <cstdint>
     # include <inttypes.h>
     # include <eratosthene-include.h>
@@ -52,6 +56,9 @@
     header - preprocessor definitions
  */
 
+    /* define halo record type */
+    # define LC_HASH_HALO ( 0 )
+
 /*
     header - preprocessor macros
  */
@@ -86,13 +93,73 @@
      *  the sub-model file name. All elements sharing the same h_i values are
      *  then written in the same sub-model.
      *
-     *  \param lc_istream Input stream descriptor
+     *  The sub-models are written through a writer cache (\b lc_cache_t) that
+     *  keeps a bounded pool of open and buffered sub-model files, avoiding to
+     *  open and close a file for each exported record.
+     *
+     *  \param lc_istream Input stream reader
+     *  \param lc_opath   Output directory path
+     *  \param lc_param   Hashing parameter
+     *  \param lc_mean    Minimum distance mean value
+     */
+
+    le_void_t lc_hash( lc_uv3_t & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean );
+
+    /*! \brief hashing methods
+     *
+     *  This function implements a variation of the hashing process of the
+     *  \b lc_hash() function. Each record is written in its sub-model as the
+     *  hash function defines it. In addition, each record is also written in
+     *  the adjacent sub-models whose cell is closer than the provided halo
+     *  distance. These copies have their type set to \b LC_HASH_HALO.
+     *
+     *  Each sub-model then contains its own records surrounded by a thin band
+     *  of the records of its neighbours. This allows processes working on the
+     *  sub-models separately to consider the neighbourhood of the records
+     *  located near the cell borders. The halo records are not part of the
+     *  sub-model and are not expected to be exported by such processes.
+     *
+     *  As the type of the records is used to mark the halo, the function only
+     *  considers point-based models : an error is raised on the first record
+     *  that is not a point. The halo distance is expected not to exceed the
+     *  cells size, as the halo records are only copied in the adjacent cells.
+     *
+     *  \param lc_istream Input stream reader
+     *  \param lc_opath   Output directory path
+     *  \param lc_param   Hashing parameter
+     *  \param lc_mean    Minimum distance mean value
+     *  \param lc_halo    Halo distance
+     */
+
+    le_void_t lc_hash_halo( lc_uv3_t & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean, le_real_t const lc_halo );
+
+    /*! \brief hashing methods
+     *
+     *  This function implements a variation of the hashing process of the
+     *  \b lc_hash() function. The hash function and the resulting sub-models
+     *  are identical, only the way they are written differs.
+     *
+     *  The function starts by reading the input stream a first time to count
+     *  the amount of records sent in each sub-model. If the input stream size
+     *  fits in the provided memory budget, a single contiguous buffer is
+     *  allocated and partitioned according to the counts. The input stream is
+     *  then read a second time and each record is scattered at its place in
+     *  the buffer. Each sub-model file is finally written at once from its
+     *  portion of the buffer.
+     *
+     *  This allows to avoid random appends across the sub-model files, which
+     *  is valuable on storage with high access latency. If the input stream
+     *  does not fit in the provided memory budget, the function falls back
+     *  to the \b lc_hash() streaming process.
+     *
+     *  \param lc_istream Input stream reader
      *  \param lc_opath   Output directory path
      *  \param lc_param   Hashing parameter
      *  \param lc_mean    Minimum distance mean value
+     *  \param lc_budget  Memory budget, in bytes
      */
 
-    le_void_t lc_hash( std::ifstream & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean );
+    le_void_t lc_hash_bucket( lc_uv3_t & lc_istream, le_char_t const * const lc_opath, le_real_t const lc_param, le_real_t const lc_mean, le_size_t const lc_budget );
 
 /*
     header - inclusion guard
@@ -49,13 +49,19 @@
  */
 
     # include "common-args.hpp"
+    # include "common-cache.hpp"
     # include "common-error.hpp"
     # include "common-file.hpp"
     # include "common-filter.hpp"
     # include "common-geometry.hpp"
+    # include "common-grid.hpp"
     # include "common-hash.hpp"
+    # include "common-parse.hpp"
     # include "common-statistic.hpp"
     # include "common-temp.hpp"
+    # include "common-thread.hpp"
+    # include "common-tree.hpp"
+    # include "common-uv3.hpp"
 
 /*
     header - external includes
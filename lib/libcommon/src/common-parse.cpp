@@ -0,0 +1,203 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "common-parse.hpp"
+
+/*
+    source - parsing methods
+ */
+
+    char const * lc_parse_real( char const * const lc_string, le_real_t & lc_value ) {
+
+        /* powers of ten variable */
+        static le_real_t const lc_power[LC_PARSE_EXPONENT + 1] = {
+
+            1e0 , 1e1 , 1e2 , 1e3 , 1e4 , 1e5 , 1e6 , 1e7 , 1e8 , 1e9 , 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+
+        };
+
+        /* parsing variable */
+        char const * lc_parse( lc_string );
+
+        /* sign variable */
+        bool lc_sign( false );
+
+        /* mantissa variable */
+        uint64_t lc_mantissa( 0 );
+
+        /* digits variable */
+        le_size_t lc_digits( 0 );
+
+        /* digits variable */
+        le_size_t lc_count( 0 );
+
+        /* exponent variable */
+        int lc_exponent( 0 );
+
+        /* exponent variable */
+        int lc_explicit( 0 );
+
+        /* exponent sign variable */
+        bool lc_esign( false );
+
+        /* fallback variable */
+        char * lc_tail( nullptr );
+
+        /* parse sign */
+        if ( ( * lc_parse ) == '-' ) {
+
+            /* update sign */
+            lc_sign = true;
+
+            /* update position */
+            lc_parse ++;
+
+        } else if ( ( * lc_parse ) == '+' ) {
+
+            /* update position */
+            lc_parse ++;
+
+        }
+
+        /* parse integral digits */
+        while ( ( ( * lc_parse ) >= '0' ) && ( ( * lc_parse ) <= '9' ) ) {
+
+            /* check significant digit */
+            if ( ( lc_mantissa != 0 ) || ( ( * lc_parse ) != '0' ) ) {
+
+                /* update mantissa */
+                lc_mantissa = lc_mantissa * 10 + ( ( * lc_parse ) - '0' );
+
+                /* update digits */
+                lc_digits ++;
+
+            }
+
+            /* update position */
+            lc_parse ++;
+
+            /* update digits */
+            lc_count ++;
+
+        }
+
+        /* parse fractional digits */
+        if ( ( * lc_parse ) == '.' ) {
+
+            /* update position */
+            lc_parse ++;
+
+            /* parsing digits */
+            while ( ( ( * lc_parse ) >= '0' ) && ( ( * lc_parse ) <= '9' ) ) {
+
+                /* check significant digit */
+                if ( ( lc_mantissa != 0 ) || ( ( * lc_parse ) != '0' ) ) {
+
+                    /* update mantissa */
+                    lc_mantissa = lc_mantissa * 10 + ( ( * lc_parse ) - '0' );
+
+                    /* update digits */
+                    lc_digits ++;
+
+                }
+
+                /* update exponent */
+                lc_exponent --;
+
+                /* update position */
+                lc_parse ++;
+
+                /* update digits */
+                lc_count ++;
+
+            }
+
+        }
+
+        /* parse exponent */
+        if ( ( lc_count > 0 ) && ( ( ( * lc_parse ) == 'e' ) || ( ( * lc_parse ) == 'E' ) ) ) {
+
+            /* update position */
+            lc_parse ++;
+
+            /* parse exponent sign */
+            if ( ( * lc_parse ) == '-' ) {
+
+                /* update sign */
+                lc_esign = true;
+
+                /* update position */
+                lc_parse ++;
+
+            } else if ( ( * lc_parse ) == '+' ) {
+
+                /* update position */
+                lc_parse ++;
+
+            }
+
+            /* check exponent digits */
+            if ( ( ( * lc_parse ) < '0' ) || ( ( * lc_parse ) > '9' ) ) {
+
+                /* reject fast path */
+                lc_count = 0;
+
+            }
+
+            /* parse exponent digits */
+            while ( ( ( * lc_parse ) >= '0' ) && ( ( * lc_parse ) <= '9' ) ) {
+
+                /* update exponent - saturated */
+                if ( lc_explicit < 100000 ) lc_explicit = lc_explicit * 10 + ( ( * lc_parse ) - '0' );
+
+                /* update position */
+                lc_parse ++;
+
+            }
+
+            /* update exponent */
+            lc_exponent += lc_esign ? - lc_explicit : lc_explicit;
+
+        }
+
+        /* check fast path */
+        if ( ( lc_count > 0 ) && ( lc_digits <= LC_PARSE_DIGITS ) && ( lc_exponent >= - LC_PARSE_EXPONENT ) && ( lc_exponent <= LC_PARSE_EXPONENT ) ) {
+
+            /* compute value */
+            lc_value = ( lc_exponent < 0 ) ? le_real_t( lc_mantissa ) / lc_power[- lc_exponent] : le_real_t( lc_mantissa ) * lc_power[lc_exponent];
+
+            /* apply sign */
+            if ( lc_sign == true ) lc_value = - lc_value;
+
+            /* send position */
+            return( lc_parse );
+
+        }
+
+        /* fallback parsing */
+        lc_value = std::strtod( lc_string, & lc_tail );
+
+        /* send position */
+        return( lc_tail );
+
+    }
+
@@ -0,0 +1,104 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   common-parse.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *
+     *  dalai-suite - common library - parse
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_PARSE__
+    # define __LC_PARSE__
+
+/*
+    header - internal includes
+ */
+
+/*
+    header - external includes
+ */
+
+    # include <cstdlib>
+    # include <cstdint>
+    # include <eratosthene-include.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define fast path limits */
+    # define LC_PARSE_DIGITS   ( 15 )
+    # define LC_PARSE_EXPONENT ( 22 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief parsing methods
+     *
+     *  This function parses the decimal number starting at the provided
+     *  string position and returns the position of its first character not
+     *  belonging to the number. The parsed value is returned through the
+     *  provided reference.
+     *
+     *  The sign, the digits and the exponent are parsed by hand. When the
+     *  number has at most LC_PARSE_DIGITS significant digits and a decimal
+     *  exponent not exceeding LC_PARSE_EXPONENT in absolute value, both the
+     *  digits and the power of ten are exactly represented and the value is
+     *  computed by a single correctly rounded multiplication or division. In
+     *  any other case, including special values, the standard strtod()
+     *  function is used. The parsed value is then always the one strtod()
+     *  would give.
+     *
+     *  The string has to be terminated by a character not belonging to a
+     *  number, such as a space or a null character. If no number is found,
+     *  the provided position is returned and the value is set to zero.
+     *
+     *  \param lc_string String position
+     *  \param lc_value  Parsed value
+     *
+     *  \return Returns position following the parsed number
+     */
+
+    char const * lc_parse_real( char const * const lc_string, le_real_t & lc_value );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
@@ -25,7 +25,53 @@
     source - statistical methods
  */
 
-    le_real_t lc_statistic_mdmv( std::ifstream & lc_istream, le_size_t const lc_count ) {
+    le_real_t lc_statistic_side( le_byte_t const * const lc_sample, le_size_t const lc_count, le_size_t const lc_real ) {
+
+        /* samples tree variable */
+        lc_tree_t lc_tree( lc_sample, lc_count );
+
+        /* distance variable */
+        le_real_t lc_distance( 0.0 );
+
+        /* accumulation variable */
+        le_real_t lc_mean( 0.0 );
+
+        /* accumulation variable */
+        le_size_t lc_valid( 0 );
+
+        /* parsing samples */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
+
+            /* search sample nearest neighbour */
+            lc_distance = lc_tree.tr_get_nearest( lc_parse );
+
+            /* avoid matching and isolated samples */
+            if ( ( lc_distance > 0.0 ) && ( lc_distance < std::numeric_limits < le_real_t >::max() ) ) {
+
+                /* accumulate distance */
+                lc_mean += std::sqrt( lc_distance );
+
+                /* update accumulation count */
+                lc_valid ++;
+
+            }
+
+        }
+
+        /* check accumulation */
+        if ( lc_valid == 0 ) {
+
+            /* no estimation */
+            return( 0.0 );
+
+        }
+
+        /* scale samples spacing to records spacing - volumetric assumption */
+        return( ( lc_mean / le_real_t( lc_valid ) ) * std::cbrt( le_real_t( lc_count ) / le_real_t( std::max( lc_real, lc_count ) ) ) * LC_STATISTIC_SCALE );
+
+    }
+
+    le_real_t lc_statistic_mdmv( lc_uv3_t & lc_istream, le_size_t const lc_count ) {
 
         /* value variable */
         le_real_t * lc_value( nullptr );
@@ -36,12 +82,48 @@
         /* buffer variable */
         le_byte_t * lc_buffer( nullptr );
 
+        /* pending samples variable */
+        le_size_t * lc_pending( nullptr );
+
+        /* pending samples variable */
+        le_size_t lc_remain( 0 );
+
+        /* spatial hash variable */
+        std::unordered_map < lc_cache_key_t, std::vector < le_size_t >, lc_cache_hash_t > lc_bin[LC_STATISTIC_LEVEL];
+
+        /* spatial hash iterator variable */
+        std::unordered_map < lc_cache_key_t, std::vector < le_size_t >, lc_cache_hash_t >::iterator lc_find;
+
+        /* spatial hash filter variable */
+        std::vector < uint32_t > lc_filter[LC_STATISTIC_LEVEL];
+
+        /* spatial hash function variable */
+        lc_cache_hash_t lc_hash;
+
+        /* resolved samples variable */
+        std::vector < std::pair < le_size_t, le_size_t > > lc_resolved;
+
+        /* key variable */
+        lc_cache_key_t lc_key;
+
+        /* key variable */
+        lc_cache_key_t lc_near;
+
         /* reading variable */
-        le_size_t lc_read( 1 );
+        le_size_t lc_read( 0 );
 
         /* size variable */
         le_size_t lc_size( 0 );
 
+        /* levels count variable */
+        le_size_t lc_levels( 0 );
+
+        /* bin side variable */
+        le_real_t lc_side[LC_STATISTIC_LEVEL];
+
+        /* unresolved samples variable */
+        le_size_t lc_open[LC_STATISTIC_LEVEL];
+
         /* distance variable */
         le_real_t lc_distance( 0.0 );
 
@@ -51,17 +133,11 @@
         /* buffer pointer variable */
         le_real_t * lc_uv3s( nullptr );
 
-        /* reset stream */
-        lc_istream.clear();
-
-        /* stream offset to end */
-        lc_istream.seekg( 0, std::ios::end );
-
         /* retrieve stream size */
-        lc_size = lc_istream.tellg();
+        lc_size = lc_istream.uv_get_size();
 
         /* allocate buffer memory */
-        if ( ( lc_buffer = new ( std::nothrow ) le_byte_t[LE_ARRAY_DATA * LE_UV3_CHUNK] ) == nullptr ) {
+        if ( ( lc_sample = new ( std::nothrow ) le_byte_t[LE_ARRAY_DATA * lc_count] ) == nullptr ) {
 
             /* send message */
             throw( LC_ERROR_MEMORY );
@@ -69,7 +145,7 @@
         }
 
         /* allocate buffer memory */
-        if ( ( lc_sample = new ( std::nothrow ) le_byte_t[LE_ARRAY_DATA * lc_count] ) == nullptr ) {
+        if ( ( lc_value = new ( std::nothrow ) le_real_t[lc_count] ) == nullptr ) {
 
             /* send message */
             throw( LC_ERROR_MEMORY );
@@ -77,7 +153,7 @@
         }
 
         /* allocate buffer memory */
-        if ( ( lc_value = new ( std::nothrow ) le_real_t[lc_count] ) == nullptr ) {
+        if ( ( lc_pending = new ( std::nothrow ) le_size_t[lc_count] ) == nullptr ) {
 
             /* send message */
             throw( LC_ERROR_MEMORY );
@@ -90,49 +166,210 @@
             /* initialise value array */
             lc_value[lc_parse] = std::numeric_limits<le_real_t>::max();
 
-            /* select homogeneous stream record */
-            lc_istream.seekg( ( ( lc_size / LE_ARRAY_DATA ) / lc_count ) * LE_ARRAY_DATA * lc_parse );
+            /* import homogeneous stream record - increasing offsets */
+            lc_istream.uv_get_record( ( ( lc_size / LE_ARRAY_DATA ) / lc_count ) * lc_parse, lc_sample + lc_parse * LE_ARRAY_DATA );
+
+        }
+
+        /* estimate bin side */
+        lc_side[0] = lc_statistic_side( lc_sample, lc_count, lc_size / LE_ARRAY_DATA );
+
+        /* check estimation - exhaustive search otherwise */
+        if ( lc_side[0] > 0.0 ) {
+
+            /* parsing levels */
+            for ( lc_levels = 0; lc_levels < LC_STATISTIC_LEVEL; lc_levels ++ ) {
+
+                /* check level */
+                if ( lc_levels > 0 ) {
+
+                    /* compute level bin side */
+                    lc_side[lc_levels] = lc_side[lc_levels - 1] * LC_STATISTIC_GROW;
+
+                }
+
+                /* initialise unresolved samples */
+                lc_open[lc_levels] = lc_count;
+
+                /* initialise spatial hash filter */
+                lc_filter[lc_levels].assign( LC_STATISTIC_FILTER, 0 );
+
+                /* parsing samples */
+                for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
+
+                    /* compute sample bin */
+                    lc_statistic_key( ( le_real_t * ) ( lc_sample + lc_parse * LE_ARRAY_DATA ), lc_side[lc_levels], lc_key );
+
+                    /* parsing adjacent bins */
+                    for ( le_size_t lc_index( 0 ); lc_index < 27; lc_index ++ ) {
+
+                        /* compute adjacent bin key */
+                        lc_near.ck_x = lc_key.ck_x + ( lc_index % 3 ) - 1;
+                        lc_near.ck_y = lc_key.ck_y + ( ( lc_index / 3 ) % 3 ) - 1;
+                        lc_near.ck_z = lc_key.ck_z + ( lc_index / 9 ) - 1;
+
+                        /* register sample in adjacent bin */
+                        lc_bin[lc_levels][lc_near].push_back( lc_parse );
+
+                        /* update spatial hash filter */
+                        lc_filter[lc_levels][lc_hash( lc_near ) & ( LC_STATISTIC_FILTER - 1 )] ++;
+
+                    }
+
+                }
+
+            }
+
+            /* reset input stream */
+            lc_istream.uv_set_reset();
+
+            /* stream chunk reading */
+            while ( ( lc_read = lc_istream.uv_get_chunk( & lc_buffer ) ) > 0 ) {
+
+                /* parsing chunk */
+                for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
+
+                    /* create buffer pointer */
+                    lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
+
+                    /* parsing levels */
+                    for ( le_size_t lc_level( 0 ); lc_level < lc_levels; lc_level ++ ) {
+
+                        /* check unresolved samples - levels are searched for them only */
+                        if ( ( lc_level > 0 ) && ( lc_open[lc_level] == 0 ) ) break;
+
+                        /* compute record bin */
+                        lc_statistic_key( lc_uv3p, lc_side[lc_level], lc_key );
+
+                        /* check spatial hash filter - avoid search of empty bins */
+                        if ( lc_filter[lc_level][lc_hash( lc_key ) & ( LC_STATISTIC_FILTER - 1 )] == 0 ) continue;
+
+                        /* search record bin */
+                        if ( ( lc_find = lc_bin[lc_level].find( lc_key ) ) == lc_bin[lc_level].end() ) continue;
+
+                        /* parsing nearby samples */
+                        for ( le_size_t lc_index : lc_find->second ) {
+
+                            /* check resolution - nearest neighbour already in finer level neighbourhood */
+                            if ( ( lc_level > 0 ) && ( lc_value[lc_index] < lc_side[lc_level - 1] * lc_side[lc_level - 1] ) ) continue;
+
+                            /* create buffer pointer */
+                            lc_uv3s = ( le_real_t * ) ( lc_sample + lc_index * LE_ARRAY_DATA );
+
+                            /* compute and check distance */
+                            if ( ( lc_distance = lc_geometry_squaredist( lc_uv3p, lc_uv3s ) ) < lc_value[lc_index] ) {
+
+                                /* avoid matching element */
+                                if ( lc_distance > 0.0 ) {
+
+                                    /* parsing coarser levels */
+                                    for ( le_size_t lc_coarse( 1 ); lc_coarse < lc_levels; lc_coarse ++ ) {
+
+                                        /* check sample resolution on finer level */
+                                        if ( ( lc_value[lc_index] >= lc_side[lc_coarse - 1] * lc_side[lc_coarse - 1] ) && ( lc_distance < lc_side[lc_coarse - 1] * lc_side[lc_coarse - 1] ) ) {
+
+                                            /* push resolved sample */
+                                            lc_resolved.push_back( std::make_pair( lc_index, lc_coarse ) );
+
+                                        }
+
+                                    }
+
+                                    /* update minimal distance */
+                                    lc_value[lc_index] = lc_distance;
+
+                                }
+
+                            }
+
+                        }
+
+                    }
 
-            /* import selected stream record */
-            lc_istream.read( ( char * ) ( lc_sample + lc_parse * LE_ARRAY_DATA ), LE_ARRAY_DATA );
+                    /* parsing resolved samples */
+                    for ( std::pair < le_size_t, le_size_t > const & lc_sample_level : lc_resolved ) {
+
+                        /* compute sample bin */
+                        lc_statistic_key( ( le_real_t * ) ( lc_sample + lc_sample_level.first * LE_ARRAY_DATA ), lc_side[lc_sample_level.second], lc_key );
+
+                        /* parsing adjacent bins */
+                        for ( le_size_t lc_index( 0 ); lc_index < 27; lc_index ++ ) {
+
+                            /* compute adjacent bin key */
+                            lc_near.ck_x = lc_key.ck_x + ( lc_index % 3 ) - 1;
+                            lc_near.ck_y = lc_key.ck_y + ( ( lc_index / 3 ) % 3 ) - 1;
+                            lc_near.ck_z = lc_key.ck_z + ( lc_index / 9 ) - 1;
+
+                            /* bin samples variable */
+                            std::vector < le_size_t > & lc_list( lc_bin[lc_sample_level.second][lc_near] );
+
+                            /* unregister sample from adjacent bin */
+                            * std::find( lc_list.begin(), lc_list.end(), lc_sample_level.first ) = lc_list.back();
+
+                            /* remove bin last sample */
+                            lc_list.pop_back();
+
+                            /* update spatial hash filter */
+                            lc_filter[lc_sample_level.second][lc_hash( lc_near ) & ( LC_STATISTIC_FILTER - 1 )] --;
+
+                        }
+
+                        /* update unresolved samples */
+                        lc_open[lc_sample_level.second] --;
+
+                    }
+
+                    /* reset resolved samples */
+                    lc_resolved.clear();
+
+                }
+
+            }
 
         }
 
-        /* reset stream */
-        lc_istream.clear();
+        /* parsing samples */
+        for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
 
-        /* stream offset to begining */
-        lc_istream.seekg( 0, std::ios::beg );
+            /* check resolution - nearest neighbour in coarsest level neighbourhood */
+            if ( ( lc_levels > 0 ) && ( lc_value[lc_parse] < lc_side[lc_levels - 1] * lc_side[lc_levels - 1] ) ) continue;
 
-        /* stream chunk reading */
-        while ( lc_read > 0 ) {
+            /* keep sample pending */
+            lc_pending[lc_remain ++] = lc_parse;
 
-            /* read stream chunk */
-            lc_istream.read( ( char * ) lc_buffer, LE_ARRAY_DATA * LE_UV3_CHUNK );
+        }
 
-            /* read byte count */
-            lc_read = lc_istream.gcount();
+        /* check pending samples */
+        if ( lc_remain > 0 ) {
 
-            /* parsing chunk */
-            for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
+            /* reset input stream */
+            lc_istream.uv_set_reset();
 
-                /* create buffer pointer */
-                lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
+            /* stream chunk reading */
+            while ( ( lc_read = lc_istream.uv_get_chunk( & lc_buffer ) ) > 0 ) {
 
-                /* parsing sample array */
-                for ( le_size_t lc_index( 0 ); lc_index < lc_count; lc_index ++ ) {
+                /* parsing chunk */
+                for ( le_size_t lc_parse( 0 ); lc_parse < lc_read; lc_parse += LE_ARRAY_DATA ) {
 
                     /* create buffer pointer */
-                    lc_uv3s = ( le_real_t * ) ( lc_sample + lc_index * LE_ARRAY_DATA );
+                    lc_uv3p = ( le_real_t * ) ( lc_buffer + lc_parse );
 
-                    /* compute and check distance */
-                    if ( ( lc_distance = lc_geometry_squaredist( lc_uv3p, lc_uv3s ) ) < lc_value[lc_index] ) {
+                    /* parsing pending samples */
+                    for ( le_size_t lc_index( 0 ); lc_index < lc_remain; lc_index ++ ) {
 
-                        /* avoid matching element */
-                        if ( lc_distance > 0.0 ) {
+                        /* create buffer pointer */
+                        lc_uv3s = ( le_real_t * ) ( lc_sample + lc_pending[lc_index] * LE_ARRAY_DATA );
 
-                            /* update minimal distance */
-                            lc_value[lc_index] = lc_distance;
+                        /* compute and check distance */
+                        if ( ( lc_distance = lc_geometry_squaredist( lc_uv3p, lc_uv3s ) ) < lc_value[lc_pending[lc_index]] ) {
+
+                            /* avoid matching element */
+                            if ( lc_distance > 0.0 ) {
+
+                                /* update minimal distance */
+                                lc_value[lc_pending[lc_index]] = lc_distance;
+
+                            }
 
                         }
 
@@ -156,16 +393,25 @@
         }
 
         /* release buffer memory */
-        delete [] lc_value;
+        delete [] lc_pending;
 
         /* release buffer memory */
-        delete [] lc_sample;
+        delete [] lc_value;
 
         /* release buffer memory */
-        delete [] lc_buffer;
+        delete [] lc_sample;
 
         /* compute and return minimal distance mean */
         return( lc_distance / le_real_t( lc_count ) );
 
     }
 
+    le_void_t lc_statistic_key( le_real_t const * const lc_pose, le_real_t const lc_side, lc_cache_key_t & lc_key ) {
+
+        /* compute bin key - signed values */
+        lc_key.ck_x = le_size_t( int64_t( std::floor( lc_pose[0] / lc_side ) ) );
+        lc_key.ck_y = le_size_t( int64_t( std::floor( lc_pose[1] / lc_side ) ) );
+        lc_key.ck_z = le_size_t( int64_t( std::floor( lc_pose[2] / lc_side ) ) );
+
+    }
+
@@ -37,7 +37,10 @@
  */
 
     # include "common-error.hpp"
+    # include "common-uv3.hpp"
     # include "common-geometry.hpp"
+    # include "common-cache.hpp"
+    # include "common-tree.hpp"
 
 /*
     header - external includes
@@ -47,12 +50,28 @@
     # include <cstdlib>
     # include <limits>
     # include <cmath>
+    # include <cstdint>
+    # include <algorithm>
+    # include <vector>
+    # include <unordered_map>
     # include <eratosthene-include.h>
 
 /*
     header - preprocessor definitions
  */
 
+    /* define bin side safety factor */
+    # define LC_STATISTIC_SCALE ( 2.0 )
+
+    /* define bin side enlargement factor */
+    # define LC_STATISTIC_GROW ( 4.0 )
+
+    /* define spatial hash levels */
+    # define LC_STATISTIC_LEVEL ( 3 )
+
+    /* define spatial hash filter size - power of two */
+    # define LC_STATISTIC_FILTER ( 262144 )
+
 /*
     header - preprocessor macros
  */
@@ -69,6 +88,30 @@
     header - function prototypes
  */
 
+    /*! \brief statistical methods
+     *
+     *  This function estimates the spacing of the records of a model using a
+     *  sample of its records. It computes the mean value of the distances of
+     *  the samples to their nearest sample and scales it according to the
+     *  ratio between the amount of samples and the amount of records of the
+     *  model.
+     *
+     *  The scaling assumes a volumetric distribution of the records, which
+     *  over-estimates the spacing of surface-based models. The result is also
+     *  multiplied by the \b LC_STATISTIC_SCALE factor. The returned value is
+     *  then intended to be an upper bound of most of the records spacing.
+     *
+     *  If no spacing can be computed on the samples, zero is returned.
+     *
+     *  \param lc_sample Samples uv3 records buffer
+     *  \param lc_count  Amount of samples
+     *  \param lc_real   Amount of records of the model
+     *
+     *  \return Returns estimated records spacing
+     */
+
+    le_real_t lc_statistic_side( le_byte_t const * const lc_sample, le_size_t const lc_count, le_size_t const lc_real );
+
     /*! \brief statistical methods
      *
      *  This function considers the provided uv3 stream and computes the vertex
@@ -76,24 +119,55 @@
      *  a reasonable amount of time, the following strategy is considered.
      *
      *  The function starts by sampling \b lc_count elements in the input stream
-     *  provided through the stream descriptor. For each sampled element, it
+     *  provided through the stream reader. For each sampled element, it
      *  searches the distance to its closest element considering all the other
      *  element of the model. It finally computes the minimum distances mean
      *  value on the sampled set.
      *
+     *  To avoid comparing each element of the model with each sample, the
+     *  samples are registered in \b LC_STATISTIC_LEVEL spatial hashes. The bin
+     *  side of the first one is estimated by \b lc_statistic_side() and each
+     *  next one has its bins enlarged by \b LC_STATISTIC_GROW. Each sample is
+     *  registered in its bin and in the adjacent ones, so that each element of
+     *  the model is only compared to the samples found in its own bin of each
+     *  level. The samples already closer to an element than the bin side of a
+     *  level are not compared on the next levels, as their nearest element is
+     *  necessarily in the neighbourhood of this finer level. They are then
+     *  removed from the bins of the coarser levels. A counting filter of the
+     *  occupied bins of each level allows to skip the search of empty bins.
+     *
+     *  All the levels are searched in a single reading of the stream. Only the
+     *  samples for which no element is found closer than the coarsest bin side
+     *  are compared to all the elements, in a second reading of the stream.
+     *  The result is then identical to the one of an exhaustive search.
+     *
      *  The approximation of the minimum distances mean value gets better as
      *  the provided \b lc_count increases. Nevertheless, a value of 32 already
      *  allows to compute a good approximation of the minimum distances mean
      *  value. The choice of the \b lc_count depends minaly on the size of the
      *  model to analyse.
      *
-     *  \param lc_istream Input stream descriptor
+     *  \param lc_istream Input stream reader
      *  \param lc_count   Element sampling count
      *
      *  \return Returns minimum distances mean value of the model
      */
 
-    le_real_t lc_statistic_mdmv( std::ifstream & lc_istream, le_size_t const lc_count );
+    le_real_t lc_statistic_mdmv( lc_uv3_t & lc_istream, le_size_t const lc_count );
+
+    /*! \brief statistical methods
+     *
+     *  This function computes the key of the spatial hash bin containing the
+     *  provided position, the bins being cubes of side \b lc_side aligned on
+     *  the frame origin. Negative bin coordinates are wrapped in the key
+     *  unsigned values, keeping adjacent bins adjacent.
+     *
+     *  \param lc_pose Position
+     *  \param lc_side Bin side
+     *  \param lc_key  Bin key
+     */
+
+    le_void_t lc_statistic_key( le_real_t const * const lc_pose, le_real_t const lc_side, lc_cache_key_t & lc_key );
 
 /*
     header - inclusion guard
@@ -0,0 +1,144 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "common-thread.hpp"
+
+/*
+    source - thread methods
+ */
+
+    le_size_t lc_thread_count( le_size_t const lc_threads ) {
+
+        /* host concurrency variable */
+        le_size_t lc_host( std::thread::hardware_concurrency() );
+
+        /* check requested amount */
+        if ( lc_threads > 0 ) {
+
+            /* return requested amount */
+            return( lc_threads );
+
+        }
+
+        /* return host concurrency */
+        return( lc_host > 0 ? lc_host : 1 );
+
+    }
+
+    le_void_t lc_thread( le_size_t const lc_count, le_size_t const lc_threads, std::function < le_void_t ( le_size_t const ) > const & lc_task ) {
+
+        /* task index variable */
+        std::atomic < le_size_t > lc_next( 0 );
+
+        /* error variable */
+        std::atomic < int > lc_error( LC_ERROR_NONE );
+
+        /* threads variable */
+        std::vector < std::thread > lc_pool;
+
+        /* check amount of threads */
+        if ( ( lc_threads <= 1 ) || ( lc_count <= 1 ) ) {
+
+            /* parsing tasks */
+            for ( le_size_t lc_parse( 0 ); lc_parse < lc_count; lc_parse ++ ) {
+
+                /* execute task */
+                lc_task( lc_parse );
+
+            }
+
+            /* abort function */
+            return;
+
+        }
+
+        /* thread worker */
+        auto lc_worker = [ & ] () {
+
+            /* task variable */
+            le_size_t lc_index( 0 );
+
+        /* error management */
+        try {
+
+            /* parsing available tasks */
+            while ( ( lc_error == LC_ERROR_NONE ) && ( ( lc_index = lc_next ++ ) < lc_count ) ) {
+
+                /* execute task */
+                lc_task( lc_index );
+
+            }
+
+        /* error management */
+        } catch ( int lc_code ) {
+
+            /* error variable */
+            int lc_none( LC_ERROR_NONE );
+
+            /* keep first error code */
+            lc_error.compare_exchange_strong( lc_none, lc_code );
+
+        }
+
+        };
+
+    /* error management */
+    try {
+
+        /* create threads */
+        for ( le_size_t lc_parse( 0 ); ( lc_parse < lc_threads ) && ( lc_parse < lc_count ); lc_parse ++ ) {
+
+            /* create thread */
+            lc_pool.emplace_back( lc_worker );
+
+        }
+
+    /* error management */
+    } catch ( std::system_error & ) {
+
+        /* check created threads */
+        if ( lc_pool.empty() == true ) {
+
+            /* send message */
+            throw( LC_ERROR_CONTEXT );
+
+        }
+
+    }
+
+        /* parsing threads */
+        for ( auto & lc_unit : lc_pool ) {
+
+            /* wait thread termination */
+            lc_unit.join();
+
+        }
+
+        /* check error state */
+        if ( lc_error != LC_ERROR_NONE ) {
+
+            /* send message */
+            throw( int( lc_error ) );
+
+        }
+
+    }
+
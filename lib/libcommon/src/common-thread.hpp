@@ -0,0 +1,116 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   common-thread.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *
+     *  dalai-suite - common library - thread
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_THREAD__
+    # define __LC_THREAD__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-error.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <iostream>
+    # include <thread>
+    # include <atomic>
+    # include <mutex>
+    # include <vector>
+    # include <functional>
+    # include <system_error>
+    # include <eratosthene-include.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+/*
+    header - function prototypes
+ */
+
+    /*! \brief thread methods
+     *
+     *  This function returns the amount of threads to use for a parallel
+     *  process. If the provided value is zero, the amount of concurrent
+     *  threads supported by the host is returned. The provided value is
+     *  returned otherwise.
+     *
+     *  \param lc_threads Requested amount of threads
+     *
+     *  \return Returns the amount of threads to use
+     */
+
+    le_size_t lc_thread_count( le_size_t const lc_threads );
+
+    /*! \brief thread methods
+     *
+     *  This function distributes the provided amount of tasks over a pool of
+     *  threads. Each task is identified by its index, between zero and the
+     *  amount of tasks, provided to the \b lc_task function.
+     *
+     *  The tasks are not assigned statically : each thread picks the next
+     *  available task index as soon as it completes its current one. The tasks
+     *  are then started in the order of their index, allowing the caller to
+     *  schedule the heaviest ones first to balance the threads load.
+     *
+     *  If a task throws an error code, the remaining tasks are not started and
+     *  the function throws the first caught error code as soon as all threads
+     *  are terminated. If a single thread is requested, the tasks are simply
+     *  executed by the calling thread.
+     *
+     *  \param lc_count   Amount of tasks
+     *  \param lc_threads Amount of threads
+     *  \param lc_task    Task function
+     */
+
+    le_void_t lc_thread( le_size_t const lc_count, le_size_t const lc_threads, std::function < le_void_t ( le_size_t const ) > const & lc_task );
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
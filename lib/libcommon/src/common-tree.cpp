@@ -0,0 +1,279 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "common-tree.hpp"
+
+/*
+    source - constructor/destructor methods
+ */
+
+    lc_tree_t::lc_tree_t( le_byte_t const * const lc_buffer, le_size_t const lc_count )
+
+        : tr_buffer( lc_buffer )
+        , tr_count( lc_count )
+        , tr_index( nullptr )
+
+    {
+
+        /* allocate array memory */
+        if ( ( tr_index = new ( std::nothrow ) le_size_t[tr_count] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* initialise permutation */
+        for ( le_size_t lc_parse( 0 ); lc_parse < tr_count; lc_parse ++ ) {
+
+            /* assign record index */
+            tr_index[lc_parse] = lc_parse;
+
+        }
+
+        /* build tree */
+        tr_set_node( 0, tr_count, 0 );
+
+    }
+
+    lc_tree_t::~lc_tree_t() {
+
+        /* check array */
+        if ( tr_index != nullptr ) {
+
+            /* release array memory */
+            delete [] tr_index;
+
+        }
+
+    }
+
+/*
+    source - accessor methods
+ */
+
+    le_real_t lc_tree_t::tr_get_nearest( le_size_t const lc_record ) const {
+
+        /* distance variable */
+        le_real_t lc_best( std::numeric_limits < le_real_t >::max() );
+
+        /* search nearest neighbour */
+        tr_get_node_nearest( 0, tr_count, 0, lc_record, lc_best );
+
+        /* return distance */
+        return( lc_best );
+
+    }
+
+    le_size_t lc_tree_t::tr_get_count( le_size_t const lc_record, le_real_t const lc_select ) const {
+
+        /* count neighbours */
+        return( tr_get_node_count( 0, tr_count, 0, lc_record, lc_select ) );
+
+    }
+
+/*
+    source - mutator methods
+ */
+
+    le_void_t lc_tree_t::tr_set_node( le_size_t const lc_head, le_size_t const lc_tail, le_size_t const lc_depth ) {
+
+        /* median variable */
+        le_size_t lc_median( ( lc_head + lc_tail ) / 2 );
+
+        /* dimension variable */
+        le_size_t lc_dim( lc_depth % 3 );
+
+        /* check leaf */
+        if ( ( lc_tail - lc_head ) <= LC_TREE_LEAF ) return;
+
+        /* place median element */
+        std::nth_element( tr_index + lc_head, tr_index + lc_median, tr_index + lc_tail, [ this, lc_dim ] ( le_size_t const lc_a, le_size_t const lc_b ) {
+
+            /* compare coordinates */
+            return( tr_get_pose( lc_a )[lc_dim] < tr_get_pose( lc_b )[lc_dim] );
+
+        } );
+
+        /* build sub-nodes */
+        tr_set_node( lc_head, lc_median, lc_depth + 1 );
+        tr_set_node( lc_median + 1, lc_tail, lc_depth + 1 );
+
+    }
+
+/*
+    source - accessor methods
+ */
+
+    le_void_t lc_tree_t::tr_get_node_nearest( le_size_t const lc_head, le_size_t const lc_tail, le_size_t const lc_depth, le_size_t const lc_record, le_real_t & lc_best ) const {
+
+        /* median variable */
+        le_size_t lc_median( ( lc_head + lc_tail ) / 2 );
+
+        /* position variable */
+        le_real_t * lc_pose( tr_get_pose( lc_record ) );
+
+        /* distance variable */
+        le_real_t lc_distance( 0.0 );
+
+        /* check leaf */
+        if ( ( lc_tail - lc_head ) <= LC_TREE_LEAF ) {
+
+            /* parsing leaf records */
+            for ( le_size_t lc_parse( lc_head ); lc_parse < lc_tail; lc_parse ++ ) {
+
+                /* avoid searched record */
+                if ( tr_index[lc_parse] == lc_record ) continue;
+
+                /* compute and check distance */
+                if ( ( lc_distance = lc_geometry_squaredist( lc_pose, tr_get_pose( tr_index[lc_parse] ) ) ) < lc_best ) {
+
+                    /* update distance */
+                    lc_best = lc_distance;
+
+                }
+
+            }
+
+            /* abort search */
+            return;
+
+        }
+
+        /* check median record */
+        if ( tr_index[lc_median] != lc_record ) {
+
+            /* compute and check distance */
+            if ( ( lc_distance = lc_geometry_squaredist( lc_pose, tr_get_pose( tr_index[lc_median] ) ) ) < lc_best ) {
+
+                /* update distance */
+                lc_best = lc_distance;
+
+            }
+
+        }
+
+        /* compute splitting distance */
+        lc_distance = lc_pose[lc_depth % 3] - tr_get_pose( tr_index[lc_median] )[lc_depth % 3];
+
+        /* check splitting side */
+        if ( lc_distance < 0.0 ) {
+
+            /* search near side */
+            tr_get_node_nearest( lc_head, lc_median, lc_depth + 1, lc_record, lc_best );
+
+            /* search far side */
+            if ( ( lc_distance * lc_distance ) < lc_best ) tr_get_node_nearest( lc_median + 1, lc_tail, lc_depth + 1, lc_record, lc_best );
+
+        } else {
+
+            /* search near side */
+            tr_get_node_nearest( lc_median + 1, lc_tail, lc_depth + 1, lc_record, lc_best );
+
+            /* search far side */
+            if ( ( lc_distance * lc_distance ) < lc_best ) tr_get_node_nearest( lc_head, lc_median, lc_depth + 1, lc_record, lc_best );
+
+        }
+
+    }
+
+    le_size_t lc_tree_t::tr_get_node_count( le_size_t const lc_head, le_size_t const lc_tail, le_size_t const lc_depth, le_size_t const lc_record, le_real_t const lc_select ) const {
+
+        /* median variable */
+        le_size_t lc_median( ( lc_head + lc_tail ) / 2 );
+
+        /* position variable */
+        le_real_t * lc_pose( tr_get_pose( lc_record ) );
+
+        /* distance variable */
+        le_real_t lc_distance( 0.0 );
+
+        /* count variable */
+        le_size_t lc_count( 0 );
+
+        /* check leaf */
+        if ( ( lc_tail - lc_head ) <= LC_TREE_LEAF ) {
+
+            /* parsing leaf records */
+            for ( le_size_t lc_parse( lc_head ); lc_parse < lc_tail; lc_parse ++ ) {
+
+                /* avoid searched record */
+                if ( tr_index[lc_parse] == lc_record ) continue;
+
+                /* compute and check condition */
+                if ( lc_geometry_squaredist( lc_pose, tr_get_pose( tr_index[lc_parse] ) ) < lc_select ) {
+
+                    /* update count */
+                    lc_count ++;
+
+                }
+
+            }
+
+            /* return count */
+            return( lc_count );
+
+        }
+
+        /* check median record */
+        if ( tr_index[lc_median] != lc_record ) {
+
+            /* compute and check condition */
+            if ( lc_geometry_squaredist( lc_pose, tr_get_pose( tr_index[lc_median] ) ) < lc_select ) {
+
+                /* update count */
+                lc_count ++;
+
+            }
+
+        }
+
+        /* compute splitting distance */
+        lc_distance = lc_pose[lc_depth % 3] - tr_get_pose( tr_index[lc_median] )[lc_depth % 3];
+
+        /* search lower side */
+        if ( ( lc_distance < 0.0 ) || ( ( lc_distance * lc_distance ) < lc_select ) ) {
+
+            /* update count */
+            lc_count += tr_get_node_count( lc_head, lc_median, lc_depth + 1, lc_record, lc_select );
+
+        }
+
+        /* search upper side */
+        if ( ( lc_distance >= 0.0 ) || ( ( lc_distance * lc_distance ) < lc_select ) ) {
+
+            /* update count */
+            lc_count += tr_get_node_count( lc_median + 1, lc_tail, lc_depth + 1, lc_record, lc_select );
+
+        }
+
+        /* return count */
+        return( lc_count );
+
+    }
+
+    le_real_t * lc_tree_t::tr_get_pose( le_size_t const lc_record ) const {
+
+        /* return record position */
+        return( ( le_real_t * ) ( tr_buffer + lc_record * LE_ARRAY_DATA ) );
+
+    }
+
@@ -0,0 +1,225 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   common-tree.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *
+     *  dalai-suite - common library - tree
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_TREE__
+    # define __LC_TREE__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-error.hpp"
+    # include "common-geometry.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <algorithm>
+    # include <limits>
+    # include <eratosthene-include.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define tree leaf size */
+    # define LC_TREE_LEAF ( 8 )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \class lc_tree_t
+     *  \brief k-d tree class
+     *
+     *  This class implements a static k-d tree built over a buffer of uv3
+     *  records. It offers nearest neighbour and fixed radius count queries on
+     *  the records of the buffer.
+     *
+     *  The tree is implicit : it only consists in a permutation of the records
+     *  index. Each node is a range of the permutation array whose median
+     *  element splits the range along the dimension given by the node depth
+     *  (x, y and z cyclically). The records themselves are neither moved nor
+     *  duplicated, keeping the buffer order untouched. Ranges smaller than
+     *  \b LC_TREE_LEAF are not split and are searched linearly.
+     *
+     *  \var lc_tree_t::tr_buffer
+     *  uv3 records buffer
+     *  \var lc_tree_t::tr_count
+     *  Amount of records in the buffer
+     *  \var lc_tree_t::tr_index
+     *  Records index permutation array
+     */
+
+    class lc_tree_t {
+
+        private:
+
+            le_byte_t const * tr_buffer;
+
+            le_size_t tr_count;
+
+            le_size_t * tr_index;
+
+        public:
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The constructor builds the tree over the provided uv3 records buffer.
+         *  The buffer has to remain available and unchanged as long as the tree
+         *  is used.
+         *
+         *  \param lc_buffer uv3 records buffer
+         *  \param lc_count  Amount of records in the buffer
+         */
+
+        lc_tree_t( le_byte_t const * const lc_buffer, le_size_t const lc_count );
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The destructor releases the tree permutation array.
+         */
+
+        ~lc_tree_t();
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the squared distance between the specified
+         *  record and its nearest neighbour in the buffer. The record itself is
+         *  excluded from the search, but not the other records sharing its
+         *  position.
+         *
+         *  If the buffer contains no other record, the function returns the
+         *  largest representable value.
+         *
+         *  \param lc_record Record index
+         *
+         *  \return Returns the squared nearest neighbour distance
+         */
+
+        le_real_t tr_get_nearest( le_size_t const lc_record ) const;
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the amount of records of the buffer whose
+         *  squared distance to the specified record is strictly smaller than
+         *  the provided value. The record itself is excluded from the count.
+         *
+         *  \param lc_record Record index
+         *  \param lc_select Squared selection distance
+         *
+         *  \return Returns the amount of neighbours
+         */
+
+        le_size_t tr_get_count( le_size_t const lc_record, le_real_t const lc_select ) const;
+
+        private:
+
+        /*! \brief mutator methods
+         *
+         *  This function builds the node covering the provided range of the
+         *  permutation array. It places the median element of the range along
+         *  the node dimension and recursively builds the two sub-ranges.
+         *
+         *  \param lc_head  Range first element
+         *  \param lc_tail  Range end element (excluded)
+         *  \param lc_depth Node depth
+         */
+
+        le_void_t tr_set_node( le_size_t const lc_head, le_size_t const lc_tail, le_size_t const lc_depth );
+
+        /*! \brief accessor methods
+         *
+         *  This function searches the nearest neighbour of the specified record
+         *  in the node covering the provided range. The current best squared
+         *  distance is updated. Sub-ranges that can not contain a nearer record
+         *  are discarded.
+         *
+         *  \param lc_head   Range first element
+         *  \param lc_tail   Range end element (excluded)
+         *  \param lc_depth  Node depth
+         *  \param lc_record Record index
+         *  \param lc_best   Current best squared distance
+         */
+
+        le_void_t tr_get_node_nearest( le_size_t const lc_head, le_size_t const lc_tail, le_size_t const lc_depth, le_size_t const lc_record, le_real_t & lc_best ) const;
+
+        /*! \brief accessor methods
+         *
+         *  This function counts the records of the node covering the provided
+         *  range that are closer to the specified record than the selection
+         *  distance. Sub-ranges entirely outside of the selection distance are
+         *  discarded.
+         *
+         *  \param lc_head   Range first element
+         *  \param lc_tail   Range end element (excluded)
+         *  \param lc_depth  Node depth
+         *  \param lc_record Record index
+         *  \param lc_select Squared selection distance
+         *
+         *  \return Returns the amount of neighbours in the node
+         */
+
+        le_size_t tr_get_node_count( le_size_t const lc_head, le_size_t const lc_tail, le_size_t const lc_depth, le_size_t const lc_record, le_real_t const lc_select ) const;
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the pointer to the position of the specified
+         *  record in the buffer.
+         *
+         *  \param lc_record Record index
+         *
+         *  \return Returns record position pointer
+         */
+
+        le_real_t * tr_get_pose( le_size_t const lc_record ) const;
+
+    };
+
+/*
+    header - function prototypes
+ */
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
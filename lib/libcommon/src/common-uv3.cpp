@@ -0,0 +1,457 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    # include "common-uv3.hpp"
+
+/*
+    source - constructor/destructor methods
+ */
+
+    lc_uv3_t::lc_uv3_t( char const * const lc_path, le_enum_t const lc_mode, le_size_t const lc_chunk )
+
+        : uv_handle( -1 )
+        , uv_close( true )
+        , uv_mode( lc_mode )
+        , uv_stream( false )
+        , uv_map( nullptr )
+        , uv_size( 0 )
+        , uv_buffer( nullptr )
+        , uv_chunk( lc_chunk * LE_ARRAY_DATA )
+        , uv_offset( 0 )
+        , uv_last( 0 )
+
+    {
+
+        /* status structure variable */
+        struct stat lc_status;
+
+        /* check path */
+        if ( lc_path == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_ACCESS );
+
+        }
+
+        /* check standard input */
+        if ( std::strcmp( lc_path, "-" ) == 0 ) {
+
+            /* check mode */
+            if ( uv_mode == LC_UV3_WRITE ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_ACCESS );
+
+            }
+
+            /* assign standard input */
+            uv_handle = STDIN_FILENO, uv_close = false;
+
+        } else {
+
+            /* open stream */
+            if ( ( uv_handle = open( lc_path, uv_mode == LC_UV3_WRITE ? O_RDWR : O_RDONLY ) ) < 0 ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_ACCESS );
+
+            }
+
+        }
+
+        /* retrieve stream status */
+        if ( fstat( uv_handle, & lc_status ) != 0 ) {
+
+            /* delete descriptor */
+            if ( uv_close == true ) close( uv_handle );
+
+            /* send message */
+            throw( LC_ERROR_IO_ACCESS );
+
+        }
+
+        /* check stream type */
+        if ( S_ISREG( lc_status.st_mode ) ) {
+
+            /* compute stream size - whole records */
+            uv_size = ( lc_status.st_size / LE_ARRAY_DATA ) * LE_ARRAY_DATA;
+
+            /* check stream size */
+            if ( uv_size > 0 ) {
+
+                /* map stream - modifications written back in write mode */
+                if ( ( uv_map = ( le_byte_t * ) mmap( nullptr, uv_size, PROT_READ | PROT_WRITE, uv_mode == LC_UV3_WRITE ? MAP_SHARED : MAP_PRIVATE, uv_handle, 0 ) ) == MAP_FAILED ) {
+
+                    /* positioned reads fallback */
+                    uv_map = nullptr;
+
+                } else {
+
+                    /* advise access pattern */
+                    madvise( uv_map, uv_size, LC_UV3_ADVICE );
+
+                }
+
+            }
+
+        } else {
+
+            /* check mode */
+            if ( uv_mode == LC_UV3_WRITE ) {
+
+                /* delete descriptor */
+                if ( uv_close == true ) close( uv_handle );
+
+                /* send message */
+                throw( LC_ERROR_IO_ACCESS );
+
+            }
+
+            /* sequential stream */
+            uv_stream = true;
+
+        }
+
+        /* check mapping */
+        if ( uv_map == nullptr ) {
+
+            /* advise access pattern */
+            posix_fadvise( uv_handle, 0, 0, LC_UV3_FADVICE );
+
+            /* allocate buffer memory */
+            if ( ( uv_buffer = new ( std::nothrow ) le_byte_t[uv_chunk] ) == nullptr ) {
+
+                /* delete descriptor */
+                if ( uv_close == true ) close( uv_handle );
+
+                /* send message */
+                throw( LC_ERROR_MEMORY );
+
+            }
+
+        }
+
+    }
+
+    lc_uv3_t::~lc_uv3_t() {
+
+        /* check mapping */
+        if ( uv_map != nullptr ) {
+
+            /* release mapping */
+            munmap( uv_map, uv_size );
+
+        }
+
+        /* check buffer */
+        if ( uv_buffer != nullptr ) {
+
+            /* release buffer memory */
+            delete [] uv_buffer;
+
+        }
+
+        /* check descriptor */
+        if ( uv_close == true ) {
+
+            /* delete descriptor */
+            close( uv_handle );
+
+        }
+
+    }
+
+/*
+    source - accessor methods
+ */
+
+    le_size_t lc_uv3_t::uv_get_size( le_void_t ) const {
+
+        /* return stream size */
+        return( uv_size );
+
+    }
+
+    le_byte_t * lc_uv3_t::uv_get_span( le_void_t ) const {
+
+        /* return mapping pointer */
+        return( uv_map );
+
+    }
+
+    le_size_t lc_uv3_t::uv_get_chunk( le_byte_t ** const lc_chunk ) {
+
+        /* page size variable */
+        static le_size_t const lc_page( sysconf( _SC_PAGESIZE ) );
+
+        /* size variable */
+        le_size_t lc_size( 0 );
+
+        /* check mapping */
+        if ( uv_map == nullptr ) {
+
+            /* write back previous chunk */
+            uv_io_write();
+
+            /* read chunk */
+            lc_size = uv_io_read();
+
+            /* assign chunk pointer */
+            ( * lc_chunk ) = uv_buffer;
+
+            /* return chunk size */
+            return( lc_size );
+
+        }
+
+        /* check previous chunk - release its pages */
+        if ( ( uv_offset / lc_page ) > ( uv_last / lc_page ) ) {
+
+            /* release previous chunk pages */
+            madvise( uv_map + ( uv_last / lc_page ) * lc_page, ( ( uv_offset / lc_page ) - ( uv_last / lc_page ) ) * lc_page, MADV_DONTNEED );
+
+        }
+
+        /* compute chunk size */
+        lc_size = std::min( uv_chunk, uv_size - uv_offset );
+
+        /* assign chunk pointer */
+        ( * lc_chunk ) = uv_map + uv_offset;
+
+        /* update offsets */
+        uv_last = uv_offset, uv_offset += lc_size;
+
+        /* return chunk size */
+        return( lc_size );
+
+    }
+
+    le_void_t lc_uv3_t::uv_get_record( le_size_t const lc_index, le_byte_t * const lc_record ) const {
+
+        /* check stream type */
+        if ( uv_stream == true ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* check record index */
+        if ( ( ( lc_index + 1 ) * LE_ARRAY_DATA ) > uv_size ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* check mapping */
+        if ( uv_map != nullptr ) {
+
+            /* copy record */
+            std::memcpy( lc_record, uv_map + lc_index * LE_ARRAY_DATA, LE_ARRAY_DATA );
+
+        } else {
+
+            /* read record */
+            if ( pread( uv_handle, lc_record, LE_ARRAY_DATA, lc_index * LE_ARRAY_DATA ) != LE_ARRAY_DATA ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_READ );
+
+            }
+
+        }
+
+    }
+
+/*
+    source - mutator methods
+ */
+
+    le_void_t lc_uv3_t::uv_set_reset( le_void_t ) {
+
+        /* check stream type */
+        if ( ( uv_stream == true ) && ( uv_offset > 0 ) ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* write back last chunk */
+        if ( uv_map == nullptr ) uv_io_write();
+
+        /* reset offsets */
+        uv_offset = 0, uv_last = 0;
+
+    }
+
+    le_void_t lc_uv3_t::uv_set_sync( le_void_t ) {
+
+        /* check mode */
+        if ( uv_mode != LC_UV3_WRITE ) return;
+
+        /* check mapping */
+        if ( uv_map != nullptr ) {
+
+            /* synchronise mapping */
+            if ( msync( uv_map, uv_size, MS_SYNC ) != 0 ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+        } else {
+
+            /* write back last chunk */
+            uv_io_write();
+
+            /* synchronise stream */
+            if ( fsync( uv_handle ) != 0 ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+        }
+
+    }
+
+/*
+    source - i/o methods
+ */
+
+    le_size_t lc_uv3_t::uv_io_read( le_void_t ) {
+
+        /* size variable */
+        le_size_t lc_size( 0 );
+
+        /* reading variable */
+        ssize_t lc_read( 0 );
+
+        /* check stream type */
+        if ( uv_stream == false ) {
+
+            /* check stream end */
+            if ( uv_offset >= uv_size ) return( 0 );
+
+            /* compute chunk size */
+            lc_size = std::min( uv_chunk, uv_size - uv_offset );
+
+            /* reading chunk */
+            for ( le_size_t lc_done( 0 ); lc_done < lc_size; lc_done += lc_read ) {
+
+                /* read chunk segment */
+                if ( ( lc_read = pread( uv_handle, uv_buffer + lc_done, lc_size - lc_done, uv_offset + lc_done ) ) <= 0 ) {
+
+                    /* check interruption */
+                    if ( ( lc_read < 0 ) && ( errno == EINTR ) ) {
+
+                        /* retry reading */
+                        lc_read = 0; continue;
+
+                    }
+
+                    /* send message */
+                    throw( LC_ERROR_IO_READ );
+
+                }
+
+            }
+
+        } else {
+
+            /* reading chunk */
+            while ( lc_size < uv_chunk ) {
+
+                /* read chunk segment */
+                if ( ( lc_read = read( uv_handle, uv_buffer + lc_size, uv_chunk - lc_size ) ) <= 0 ) {
+
+                    /* check interruption */
+                    if ( ( lc_read < 0 ) && ( errno == EINTR ) ) continue;
+
+                    /* check error */
+                    if ( lc_read < 0 ) {
+
+                        /* send message */
+                        throw( LC_ERROR_IO_READ );
+
+                    }
+
+                    /* end of stream */
+                    break;
+
+                }
+
+                /* update chunk size */
+                lc_size += lc_read;
+
+            }
+
+            /* whole records only */
+            lc_size = ( lc_size / LE_ARRAY_DATA ) * LE_ARRAY_DATA;
+
+        }
+
+        /* update offsets */
+        uv_last = uv_offset, uv_offset += lc_size;
+
+        /* return chunk size */
+        return( lc_size );
+
+    }
+
+    le_void_t lc_uv3_t::uv_io_write( le_void_t ) {
+
+        /* writing variable */
+        ssize_t lc_write( 0 );
+
+        /* check mode */
+        if ( uv_mode != LC_UV3_WRITE ) return;
+
+        /* writing chunk */
+        for ( le_size_t lc_done( 0 ); lc_done < ( uv_offset - uv_last ); lc_done += lc_write ) {
+
+            /* write chunk segment */
+            if ( ( lc_write = pwrite( uv_handle, uv_buffer + lc_done, ( uv_offset - uv_last ) - lc_done, uv_last + lc_done ) ) <= 0 ) {
+
+                /* check interruption */
+                if ( ( lc_write < 0 ) && ( errno == EINTR ) ) {
+
+                    /* retry writing */
+                    lc_write = 0; continue;
+
+                }
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+        }
+
+        /* chunk written */
+        uv_last = uv_offset;
+
+    }
+
@@ -0,0 +1,285 @@
+/*
+ *  dalai-suite - common library
+ *
+ *      Nils Hamel - nils.hamel@alumni.epfl.ch
+ *      Copyright (c) 2016-2020 DHLAB, EPFL
+ *      Copyright (c) 2020 Republic and Canton of Geneva
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+    /*! \file   common-uv3.hpp
+     *  \author Nils Hamel <nils.hamel@alumni.epfl.ch>
+     *
+     *  dalai-suite - common library - uv3
+     */
+
+/*
+    header - inclusion guard
+ */
+
+    # ifndef __LC_UV3__
+    # define __LC_UV3__
+
+/*
+    header - internal includes
+ */
+
+    # include "common-error.hpp"
+
+/*
+    header - external includes
+ */
+
+    # include <algorithm>
+    # include <cstring>
+    # include <cerrno>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include <sys/mman.h>
+    # include <eratosthene-include.h>
+
+/*
+    header - preprocessor definitions
+ */
+
+    /* define reader mode */
+    # define LC_UV3_READ  ( 0 )
+    # define LC_UV3_WRITE ( 1 )
+
+    /* define mapping access advice */
+    # define LC_UV3_ADVICE ( MADV_SEQUENTIAL )
+
+    /* define descriptor access advice */
+    # define LC_UV3_FADVICE ( POSIX_FADV_SEQUENTIAL )
+
+/*
+    header - preprocessor macros
+ */
+
+/*
+    header - type definition
+ */
+
+/*
+    header - structures
+ */
+
+    /*! \class lc_uv3_t
+     *  \brief uv3 reader class
+     *
+     *  This class implements a reader of uv3 streams. It gives access to the
+     *  records of the stream through chunks of whole records, avoiding each
+     *  process to implement its own reading loop on its own buffer.
+     *
+     *  When the stream is a regular file, it is memory mapped and the chunks
+     *  are given directly in the mapping. The mapping is private and writable
+     *  so that processes can modify the records of a chunk in place without
+     *  affecting the file. The pages of a chunk are released as the next chunk
+     *  is requested. If the mapping fails, the chunks are read in an internal
+     *  buffer using positioned reads.
+     *
+     *  When the stream is not a regular file (pipes, standard input), the
+     *  chunks are read sequentially in the internal buffer. Such streams can
+     *  only be read once.
+     *
+     *  In \b LC_UV3_WRITE mode, the file is mapped shared and the records of
+     *  the chunks are modified in the file itself, the system writing the
+     *  modified pages back. If the mapping fails, each chunk read in the
+     *  internal buffer is written back in the file using positioned writes as
+     *  the next chunk is requested. This mode is only available on regular
+     *  files.
+     *
+     *  The access pattern is advised to the system using \b LC_UV3_ADVICE and
+     *  \b LC_UV3_FADVICE, giving a single place to tune read-ahead. Trailing
+     *  bytes not forming a complete record are ignored.
+     *
+     *  \var lc_uv3_t::uv_handle
+     *  Stream descriptor
+     *  \var lc_uv3_t::uv_close
+     *  Descriptor ownership flag
+     *  \var lc_uv3_t::uv_mode
+     *  Reader mode
+     *  \var lc_uv3_t::uv_stream
+     *  Sequential stream flag
+     *  \var lc_uv3_t::uv_map
+     *  Stream mapping - null if not mapped
+     *  \var lc_uv3_t::uv_size
+     *  Stream size, in bytes - whole records only
+     *  \var lc_uv3_t::uv_buffer
+     *  Chunk buffer - used if not mapped
+     *  \var lc_uv3_t::uv_chunk
+     *  Chunk size, in bytes
+     *  \var lc_uv3_t::uv_offset
+     *  Offset of the next chunk, in bytes
+     *  \var lc_uv3_t::uv_last
+     *  Offset of the last chunk, in bytes
+     */
+
+    class lc_uv3_t {
+
+        private:
+
+            int uv_handle;
+
+            bool uv_close;
+
+            le_enum_t uv_mode;
+
+            bool uv_stream;
+
+            le_byte_t * uv_map;
+
+            le_size_t uv_size;
+
+            le_byte_t * uv_buffer;
+
+            le_size_t uv_chunk;
+
+            le_size_t uv_offset;
+
+            le_size_t uv_last;
+
+        public:
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The constructor opens the uv3 stream pointed by the provided path.
+         *  If the path is "-", the standard input is considered. The regular
+         *  files are memory mapped. The mode, \b LC_UV3_READ or \b LC_UV3_WRITE,
+         *  specifies if the modifications of the chunks are written back in
+         *  the stream.
+         *
+         *  \param lc_path  Stream path
+         *  \param lc_mode  Reader mode
+         *  \param lc_chunk Chunk size, in records
+         */
+
+        lc_uv3_t( char const * const lc_path, le_enum_t const lc_mode = LC_UV3_READ, le_size_t const lc_chunk = LE_UV3_CHUNK );
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The destructor releases the mapping or the chunk buffer and closes
+         *  the stream. In \b LC_UV3_WRITE mode, \b uv_set_sync() has to be called
+         *  before to ensure the modifications are written.
+         */
+
+        ~lc_uv3_t();
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the size, in bytes, of the stream, considering
+         *  whole records only. For sequential streams, zero is returned.
+         *
+         *  \return Returns stream size, in bytes
+         */
+
+        le_size_t uv_get_size( le_void_t ) const;
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the pointer to the whole mapped stream. If the
+         *  stream is not mapped, a null pointer is returned. The content of the
+         *  chunks already given by \b uv_get_chunk() is not guaranteed.
+         *
+         *  \return Returns stream mapping pointer
+         */
+
+        le_byte_t * uv_get_span( le_void_t ) const;
+
+        /*! \brief accessor methods
+         *
+         *  This function gives the next chunk of records of the stream. The
+         *  pointer to the first record of the chunk is set in \b lc_chunk and
+         *  the size of the chunk, in bytes, is returned. The size is always a
+         *  multiple of the record size. Zero is returned when the end of the
+         *  stream is reached.
+         *
+         *  The content of the chunk remains valid and can be modified until
+         *  the next call to this function.
+         *
+         *  \param lc_chunk Chunk pointer
+         *
+         *  \return Returns chunk size, in bytes
+         */
+
+        le_size_t uv_get_chunk( le_byte_t ** const lc_chunk );
+
+        /*! \brief accessor methods
+         *
+         *  This function copies the record of the stream at the provided index
+         *  in the provided record buffer. It does not change the chunk reading
+         *  position.
+         *
+         *  This function is not available on sequential streams.
+         *
+         *  \param lc_index  Record index
+         *  \param lc_record Record buffer
+         */
+
+        le_void_t uv_get_record( le_size_t const lc_index, le_byte_t * const lc_record ) const;
+
+        /*! \brief mutator methods
+         *
+         *  This function resets the chunk reading position at the begining of
+         *  the stream. Sequential streams can only be reset before their first
+         *  chunk is read.
+         */
+
+        le_void_t uv_set_reset( le_void_t );
+
+        /*! \brief mutator methods
+         *
+         *  In \b LC_UV3_WRITE mode, this function writes the modifications of
+         *  the last given chunk back in the stream and waits for all the
+         *  modifications to reach the storage. In \b LC_UV3_READ mode, the
+         *  function does nothing.
+         */
+
+        le_void_t uv_set_sync( le_void_t );
+
+        private:
+
+        /*! \brief i/o methods
+         *
+         *  This function reads the next chunk of records in the chunk buffer
+         *  using read or positioned read operations, depending on the stream
+         *  type. The size of the read chunk, in bytes, is returned.
+         *
+         *  \return Returns chunk size, in bytes
+         */
+
+        le_size_t uv_io_read( le_void_t );
+
+        /*! \brief i/o methods
+         *
+         *  In \b LC_UV3_WRITE mode, this function writes the last chunk read in
+         *  the chunk buffer back in the stream using positioned writes.
+         */
+
+        le_void_t uv_io_write( le_void_t );
+
+    };
+
+/*
+    header - function prototypes
+ */
+
+/*
+    header - inclusion guard
+ */
+
+    # endif
+
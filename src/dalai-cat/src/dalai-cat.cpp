@@ -58,8 +58,8 @@
 
     int main( int argc, char ** argv ) {
 
-        /* stream buffer variable */
-        le_byte_t dl_buffer[LE_ARRAY_DATA];
+        /* stream chunk variable */
+        le_byte_t * dl_buffer( nullptr );
 
         /* buffer pointer variable */
         le_real_t * dl_uv3p( nullptr );
@@ -71,39 +71,25 @@
         le_byte_t dl_index( lc_read_unsigned( argc, argv, "--index", "-x", 0 ) );
 
         /* reading variable */
-        le_size_t dl_read( 1 );
-
-        /* stream variables */
-        std::ifstream dl_stream;
+        le_size_t dl_read( 0 );
 
     /* error management */
     try {
 
-        /* create input stream */
-        dl_stream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
-
-        /* check stream */
-        if ( dl_stream.is_open() != true ) {
-
-            /* send message */
-            throw( LC_ERROR_IO_READ );
-
-        }
-
-        /* compute buffer pointer */
-        dl_uv3p = ( le_real_t * ) ( dl_buffer );
-
-        /* compute buffer pointer */
-        dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
+        /* create input stream reader */
+        lc_uv3_t dl_stream( lc_read_string( argc, argv, "--input", "-i" ) );
 
         /* stream reading */
-        while ( dl_read != 0 ) {
+        while ( ( dl_read = dl_stream.uv_get_chunk( & dl_buffer ) ) > 0 ) {
 
-            /* read stream record */
-            dl_stream.read( ( char * ) dl_buffer, LE_ARRAY_DATA );
+            /* parsing stream chunk */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA ) {
 
-            /* check read record */
-            if ( ( dl_read = dl_stream.gcount() ) == LE_ARRAY_DATA ) {
+                /* compute buffer pointer */
+                dl_uv3p = ( le_real_t * ) ( dl_buffer + dl_parse );
+
+                /* compute buffer pointer */
+                dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
 
                 /* check display format */
                 if ( dl_index == 0 ) {
@@ -125,9 +111,6 @@
 
         }
 
-        /* delete stream */
-        dl_stream.close();
-
     /* error management */
     } catch ( int dl_code ) {
 
@@ -58,20 +58,20 @@
         /* colormap boundary variable */
         le_real_t dl_hedge( lc_read_double( argc, argv, "--maximum", "-x", 50.0 ) );
 
-        /* reading variable */
-        le_size_t dl_read( 1 );
+        /* in-place variable */
+        bool dl_place( lc_read_flag( argc, argv, "--in-place", "-p" ) );
 
-        /* stream buffer variable */
-        le_byte_t * dl_buffer( nullptr );
+        /* threads variable */
+        le_size_t dl_threads( lc_thread_count( lc_read_unsigned( argc, argv, "--threads", "-n", 0 ) ) );
 
-        /* buffer pointer variable */
-        le_real_t * dl_uv3p( nullptr );
+        /* reading variable */
+        le_size_t dl_read( 0 );
 
-        /* buffer pointer variable */
-        le_data_t * dl_uv3d( nullptr );
+        /* records variable */
+        le_size_t dl_count( 0 );
 
-        /* stream variable */
-        std::ifstream dl_istream;
+        /* stream chunk variable */
+        le_byte_t * dl_buffer( nullptr );
 
         /* stream variable */
         std::ofstream dl_ostream;
@@ -79,50 +79,45 @@
     /* error management */
     try {
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
+        /* create input stream reader */
+        lc_uv3_t dl_istream( lc_read_string( argc, argv, "--input", "-i" ), dl_place == true ? LC_UV3_WRITE : LC_UV3_READ );
 
-        /* check input stream */
-        if ( dl_istream.is_open() == false ) {
+        /* check mode */
+        if ( dl_place == false ) {
 
-            /* send message */
-            return( LC_ERROR_IO_READ );
+            /* create output stream */
+            dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
 
-        }
-
-        /* create output stream */
-        dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+            /* check output stream */
+            if ( dl_ostream.is_open() == false ) {
 
-        /* check output stream */
-        if ( dl_ostream.is_open() == false ) {
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
 
-            /* send message */
-            return( LC_ERROR_IO_WRITE );
+            }
 
         }
 
-        /* allocate and check memory */
-        if ( ( dl_buffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
-
-            /* send message */
-            return( LC_ERROR_MEMORY );
+        /* stream reading */
+        while ( ( dl_read = dl_istream.uv_get_chunk( & dl_buffer ) ) > 0 ) {
 
-        }
+            /* compute chunk records */
+            dl_count = dl_read / LE_ARRAY_DATA;
 
-        /* stream reading */
-        while ( dl_read != 0 ) {
+            /* parsing chunk slices */
+            lc_thread( dl_threads, dl_threads, [&] ( le_size_t const dl_slice ) {
 
-            /* read stream chunk */
-            dl_istream.read( ( char * ) dl_buffer, LE_UV3_CHUNK * LE_ARRAY_DATA );
+                /* buffer pointer variable */
+                le_real_t * dl_uv3p( nullptr );
 
-            /* check read bytes */
-            if ( ( dl_read = dl_istream.gcount() ) != 0 ) {
+                /* buffer pointer variable */
+                le_data_t * dl_uv3d( nullptr );
 
-                /* parsing stream chunk */
-                for ( le_size_t dl_parse( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA ) {
+                /* parsing slice records */
+                for ( le_size_t dl_parse( ( dl_count * dl_slice ) / dl_threads ); dl_parse < ( dl_count * ( dl_slice + 1 ) ) / dl_threads; dl_parse ++ ) {
 
                     /* compute buffer pointer */
-                    dl_uv3p = ( le_real_t * ) ( dl_buffer + dl_parse );
+                    dl_uv3p = ( le_real_t * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA );
 
                     /* compute buffer pointer */
                     dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
@@ -132,6 +127,11 @@
 
                 }
 
+            } );
+
+            /* check mode */
+            if ( dl_place == false ) {
+
                 /* write stream chunk */
                 dl_ostream.write( ( char * ) dl_buffer, dl_read );
 
@@ -139,14 +139,18 @@
 
         }
 
-        /* release buffer memory */
-        delete[] dl_buffer;
+        /* check mode */
+        if ( dl_place == true ) {
+
+            /* synchronise input stream */
+            dl_istream.uv_set_sync();
 
-        /* delete output stream */
-        dl_ostream.close();
+        } else {
 
-        /* delete input stream */
-        dl_istream.close();
+            /* delete output stream */
+            dl_ostream.close();
+
+        }
 
     /* error management */
     } catch ( int dl_code ) {
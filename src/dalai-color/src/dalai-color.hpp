@@ -103,9 +103,17 @@
      *                    --output/-o [output file]
      *                    --minimum/-m [height low boundary]
      *                    --maximum/-x [height high boundary]
+     *                    --in-place/-p [in-place transformation switch]
+     *                    --threads/-n [number of threads]
      *
      *  The resulting colored uv3 primitives are exported in the provided output
-     *  stream.
+     *  stream. With the in-place switch, no output file is created and the
+     *  input file is mapped writable, the colors being overridden directly in
+     *  the mapping and written back by the system.
+     *
+     *  The records of each read chunk are split in equal slices processed by
+     *  the specified number of threads, zero meaning the number of hardware
+     *  threads.
      *
      *  The provided maximum and minimum heights are used to set the cyclic
      *  boundaries of the applied colormap. The colormaps starts with its first
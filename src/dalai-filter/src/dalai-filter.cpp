@@ -25,13 +25,19 @@
     source - filtering methods
  */
 
-    le_void_t dl_filter( std::ofstream & dl_ostream, le_char_t const * const dl_ipath, le_real_t dl_mean, le_real_t const dl_factor, le_size_t const dl_threshold, bool const dl_adaptive ) {
+    le_void_t dl_filter( std::ofstream & dl_ostream, le_char_t const * const dl_ipath, le_real_t dl_mean, le_real_t const dl_factor, le_size_t const dl_threshold, bool const dl_adaptive, le_size_t const dl_threads ) {
 
-        /* input stream variable */
-        std::ifstream dl_istream;
+        /* cells variable */
+        std::vector < dl_cell_t > dl_cells;
 
-        /* path variable */
-        le_char_t dl_fpath[_LE_USE_PATH];
+        /* cell variable */
+        dl_cell_t dl_cell;
+
+        /* output mutex variable */
+        std::mutex dl_mutex;
+
+        /* status variable */
+        struct stat dl_status;
 
         /* directory structure variable */
         DIR * dl_directory( nullptr );
@@ -54,23 +60,24 @@
             if ( dl_entity->d_type == DT_REG ) {
 
                 /* compose path */
-                sprintf( ( char * ) dl_fpath, "%s/%s", ( char * ) dl_ipath, dl_entity->d_name );
-
-                /* check filtering method */
-                if ( dl_adaptive == true ) {
+                dl_cell.cl_path = std::string( ( char * ) dl_ipath ) + "/" + dl_entity->d_name;
 
-                    /* adaptive filtering */
-                    lc_filter_adaptative( dl_fpath, dl_ostream, dl_factor, dl_threshold );
+                /* retrieve file status */
+                if ( stat( dl_cell.cl_path.c_str(), & dl_status ) != 0 ) {
 
-                } else {
+                    /* close directory */
+                    closedir( dl_directory );
 
-                    /* homogeneous filtering */
-                    lc_filter_homogeneous( dl_fpath, dl_ostream, dl_mean, dl_factor, dl_threshold );
+                    /* send message */
+                    throw( LC_ERROR_IO_ACCESS );
 
                 }
 
-                /* remove filtered file */
-                std::remove( ( char * ) dl_fpath );
+                /* assign file size */
+                dl_cell.cl_size = dl_status.st_size;
+
+                /* push cell */
+                dl_cells.push_back( dl_cell );
 
             }
 
@@ -79,6 +86,50 @@
         /* close directory */
         closedir( dl_directory );
 
+        /* sort cells by decreasing size */
+        std::sort( dl_cells.begin(), dl_cells.end(), [] ( dl_cell_t const & dl_a, dl_cell_t const & dl_b ) {
+
+            /* compare sizes */
+            return( dl_a.cl_size > dl_b.cl_size );
+
+        } );
+
+        /* filtering cells */
+        lc_thread( dl_cells.size(), lc_thread_count( dl_threads ), [ & ] ( le_size_t const dl_index ) {
+
+            /* buffer variable */
+            std::ostringstream dl_buffer( std::ios::out | std::ios::binary );
+
+            /* filtered records variable */
+            std::string dl_records;
+
+            /* check filtering method */
+            if ( dl_adaptive == true ) {
+
+                /* adaptive filtering */
+                lc_filter_adaptative( ( le_char_t * ) dl_cells[dl_index].cl_path.c_str(), dl_buffer, dl_factor, dl_threshold );
+
+            } else {
+
+                /* homogeneous filtering */
+                lc_filter_homogeneous( ( le_char_t * ) dl_cells[dl_index].cl_path.c_str(), dl_buffer, dl_mean, dl_factor, dl_threshold );
+
+            }
+
+            /* retrieve filtered records */
+            dl_records = dl_buffer.str();
+
+            /* lock output stream */
+            std::lock_guard < std::mutex > dl_lock( dl_mutex );
+
+            /* export filtered records */
+            dl_ostream.write( dl_records.data(), dl_records.size() );
+
+            /* remove filtered file */
+            std::remove( dl_cells[dl_index].cl_path.c_str() );
+
+        } );
+
     }
 
 /*
@@ -99,31 +150,26 @@
         /* filtering mode variable */
         bool dl_mode( lc_read_flag( argc, argv, "--adaptive", "-a" ) );
 
+        /* hashing mode variable */
+        bool dl_halo( lc_read_flag( argc, argv, "--halo", "-l" ) );
+
+        /* threads variable */
+        le_size_t dl_threads( lc_read_unsigned( argc, argv, "--threads", "-n", 0 ) );
+
         /* temporary path variable */
         le_char_t dl_path[_LE_USE_PATH];
 
         /* minimum distance mean variable */
         le_real_t dl_mean( 0.0 );
 
-        /* stream variable */
-        std::ifstream dl_istream;
-
         /* stream variable */
         std::ofstream dl_ostream;
 
     /* error management */
     try {
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
-
-        /* check input stream */
-        if ( dl_istream.is_open() == false ) {
-
-            /* throw message */
-            throw( LC_ERROR_IO_ACCESS );
-
-        }
+        /* create input stream reader */
+        lc_uv3_t dl_istream( lc_read_string( argc, argv, "--input", "-i" ) );
 
         /* create output stream */
         dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
@@ -142,11 +188,21 @@
         /* compute minimum distance mean value */
         dl_mean = lc_statistic_mdmv( dl_istream, dl_count );
 
-        /* create hashed storage */
-        lc_hash( dl_istream, dl_path, DL_FILTER_HASH, dl_mean );
+        /* check hashing mode */
+        if ( dl_halo == true ) {
+
+            /* create hashed storage with halo - cells not narrower than halo */
+            lc_hash_halo( dl_istream, dl_path, std::max( le_real_t( DL_FILTER_HALO ), dl_factor ), dl_mean, dl_mean * dl_factor );
+
+        } else {
+
+            /* create hashed storage */
+            lc_hash( dl_istream, dl_path, DL_FILTER_HASH, dl_mean );
+
+        }
 
         /* filtering process */
-        dl_filter( dl_ostream, dl_path, dl_mean, dl_factor, dl_threshold, dl_mode );
+        dl_filter( dl_ostream, dl_path, dl_mean, dl_factor, dl_threshold, dl_mode, dl_threads );
 
         /* delete temporary storage */
         lc_temp_directory( nullptr, ( char * ) dl_path, LC_TEMP_DELETE );
@@ -154,9 +210,6 @@
         /* delete output stream */
         dl_ostream.close();
 
-        /* delete input stream */
-        dl_istream.close();
-
     /* error management */
     } catch ( int dl_code ) {
 
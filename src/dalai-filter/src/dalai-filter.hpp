@@ -54,8 +54,14 @@
 
     # include <iostream>
     # include <fstream>
+    # include <sstream>
+    # include <string>
+    # include <vector>
+    # include <mutex>
+    # include <algorithm>
     # include <cstdio>
     # include <dirent.h>
+    # include <sys/stat.h>
     # include <common-include.hpp>
     # include <eratosthene-include.h>
 
@@ -66,6 +72,9 @@
     /* define hashing parameter */
     # define DL_FILTER_HASH ( 75.0 )
 
+    /* define hashing parameter - halo */
+    # define DL_FILTER_HALO ( 25.0 )
+
 /*
     header - preprocessor macros
  */
@@ -78,6 +87,25 @@
     header - structures
  */
 
+    /*! \struct dl_cell_t
+     *  \brief hashed cell structure
+     *
+     *  This structure holds the description of a hashed cell file waiting to
+     *  be filtered.
+     *
+     *  \var dl_cell_t::cl_path
+     *  Cell file path
+     *  \var dl_cell_t::cl_size
+     *  Cell file size, in bytes
+     */
+
+    struct dl_cell_t {
+
+        std::string cl_path;
+        le_size_t   cl_size;
+
+    };
+
 /*
     header - function prototypes
  */
@@ -100,6 +128,13 @@
      *  methods. If \b true is provided as \b dl_adaptive parameter, the
      *  adaptive filtering process is considered, the homogeneous one otherwise.
      *
+     *  The files being independent, they are filtered in parallel by a pool of
+     *  \b dl_threads threads, the largest files being scheduled first. Each
+     *  thread filters its file in a private buffer that is then appended to
+     *  the output stream. The order of the filtered pieces in the output stream
+     *  is then not specified. If zero is provided as amount of threads, the
+     *  amount of concurrent threads supported by the host is considered.
+     *
      *  Note : The implementation of the filtering process does not takes into
      *  account the type of the read records. It is then not suitable for non
      *  point-based models.
@@ -110,9 +145,10 @@
      *  \param dl_factor    Minimum distances mean value factor
      *  \param dl_threshold Neighbour count threshold
      *  \param dl_adaptive  Adaptive filtering switch
+     *  \param dl_threads   Amount of filtering threads
      */
 
-    le_void_t dl_filter( std::ofstream & dl_ostream, le_char_t const * const dl_ipath, le_real_t dl_mean, le_real_t const dl_factor, le_size_t const dl_threshold, bool const dl_adaptive );
+    le_void_t dl_filter( std::ofstream & dl_ostream, le_char_t const * const dl_ipath, le_real_t dl_mean, le_real_t const dl_factor, le_size_t const dl_threshold, bool const dl_adaptive, le_size_t const dl_threads );
 
     /*! \brief main function
      *
@@ -123,9 +159,11 @@
      *                     --output/-o [output uv3 file path]
      *                     --temporary/-y [Temporary directory path]
      *                     --adaptive/-a [filtering mode switch]
+     *                     --halo/-l [hashing halo switch]
      *                     --factor/-f [minimum distances mean value factor]
      *                     --count/-c [sampled elements for mean computation]
      *                     --threshold/-t [neighbour count threshold]
+     *                     --threads/-n [amount of filtering threads]
      *
      *  The main function assumes that the provided input uv3 stream contains
      *  only point primitives. The filtering process does not checks the record
@@ -141,9 +179,24 @@
      *  function uses the minimum distances mean value and the default factor
      *  \b DL_FILTER_HASH to scale the hashing.
      *
+     *  If the halo switch is provided, the input stream is hashed using the
+     *  \b lc_hash_halo() function : each piece also receives the records of
+     *  its neighbour pieces that are closer than the filtering distance, the
+     *  minimum distances mean value multiplied by the factor. These records
+     *  are considered as neighbours by the filtering process but are not
+     *  exported, removing the artefacts at the borders of the pieces. As the
+     *  pieces are not isolated anymore, the smaller \b DL_FILTER_HALO factor
+     *  is used to scale the hashing, or the filtering factor if larger, as the
+     *  halo can only be taken from the adjacent pieces. In adaptive mode, the
+     *  halo distance is based on the overall minimum distances mean value. As
+     *  the halo records are marked through their type, this mode only accepts
+     *  point-based models.
+     *
      *  The filtering process is then applied on each piece of the hashed input
      *  stream and the results of the filtering of all the pieces is exported in
-     *  the output stream.
+     *  the output stream. The pieces are filtered in parallel using the amount
+     *  of threads provided by the user, all the available cores being used by
+     *  default.
      *
      *  The temporary directory is mandatory and used to store the pieces of the
      *  model created during the hashing process. It has to offer enough of free
@@ -25,31 +25,26 @@
     source - conversion methods
  */
 
-    le_void_t dl_geoid_height( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion ) {
+    le_void_t dl_geoid_height( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion, le_size_t const dl_threads, bool const dl_exact ) {
 
-        /* data buffer variable */
-        le_byte_t dl_buffer[LE_ARRAY_DATA];
+        /* lattice variable */
+        dl_lattice_t dl_lattice;
 
-        /* data pointer variable */
-        le_real_t * dl_pose( nullptr );
+        /* stream chunk variable */
+        le_byte_t * dl_buffer( nullptr );
+
+        /* reading variable */
+        le_size_t dl_read( 0 );
 
-        /* readind variable */
-        le_size_t dl_read( 1 );
+        /* records variable */
+        le_size_t dl_count( 0 );
 
         /* stream variable */
-        std::ifstream dl_istream( ( char * ) dl_input, std::ios::binary );
+        lc_uv3_t dl_istream( ( char * ) dl_input, LC_UV3_READ, DL_CHUNK );
 
         /* stream variable */
         std::ofstream dl_ostream( ( char * ) dl_output, std::ios::binary );
 
-        /* check stream */
-        if ( dl_istream.is_open() == false ) {
-
-            /* send message */
-            throw( LC_ERROR_IO_READ );
-
-        }
-
         /* check stream */
         if ( dl_ostream.is_open() == false ) {
 
@@ -59,37 +54,260 @@
         }
 
         /* parsing input stream */
-        while ( dl_read > 0 ) {
+        while ( ( dl_read = dl_istream.uv_get_chunk( & dl_buffer ) ) > 0 ) {
 
-            /* read data chunk */
-            dl_istream.read( ( char * ) dl_buffer, LE_ARRAY_DATA );
+            /* compute chunk records */
+            dl_count = dl_read / LE_ARRAY_DATA;
 
-            /* check read chunk */
-            if ( ( dl_read = dl_istream.gcount() ) > 0 ) {
+            /* check lattice availability */
+            if ( ( dl_exact == false ) && ( dl_geoid_lattice( dl_buffer, dl_count, dl_geoid, dl_lattice, dl_threads ) == true ) ) {
 
-                /* parsing chunk vertex */
-                for ( le_size_t dl_parse( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA ) {
+                /* parsing chunk slices */
+                lc_thread( dl_threads, dl_threads, [&] ( le_size_t const dl_slice ) {
 
-                    /* create data pointer */
-                    dl_pose = ( le_real_t * ) ( dl_buffer + dl_parse );
+                    /* interpolate slice vertex */
+                    dl_geoid_interpolate( dl_buffer, ( dl_count * dl_slice ) / dl_threads, ( dl_count * ( dl_slice + 1 ) ) / dl_threads, dl_lattice, dl_conversion );
 
-                    /* vertex conversion */
-                    dl_pose[2] = dl_pose[2] + dl_conversion * dl_geoid( dl_pose[1] * LE_R2D, dl_pose[0] * LE_R2D );
+                } );
 
-                }
+            } else {
+
+                /* parsing chunk slices */
+                lc_thread( dl_threads, dl_threads, [&] ( le_size_t const dl_slice ) {
 
-                /* export processed chunk */
-                dl_ostream.write( ( char * ) dl_buffer, dl_read );
+                    /* data pointer variable */
+                    le_real_t * dl_pose( nullptr );
+
+                    /* parsing slice vertex */
+                    for ( le_size_t dl_parse( ( dl_count * dl_slice ) / dl_threads ); dl_parse < ( dl_count * ( dl_slice + 1 ) ) / dl_threads; dl_parse ++ ) {
+
+                        /* create data pointer */
+                        dl_pose = ( le_real_t * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA );
+
+                        /* avoid non-finite vertex */
+                        if ( ( std::isfinite( dl_pose[0] ) == false ) || ( std::isfinite( dl_pose[1] ) == false ) ) continue;
+
+                        /* vertex conversion */
+                        dl_pose[2] = dl_pose[2] + dl_conversion * dl_geoid( dl_pose[1] * LE_R2D, dl_pose[0] * LE_R2D );
+
+                    }
+
+                } );
 
             }
 
+            /* export processed chunk */
+            dl_ostream.write( ( char * ) dl_buffer, dl_read );
+
         }
 
         /* delete stream */
         dl_ostream.close();
 
-        /* delete stream */
-        dl_istream.close();
+    }
+
+/*
+    source - lattice methods
+ */
+
+    bool dl_geoid_lattice( le_byte_t const * const dl_buffer, le_size_t const dl_count, GeographicLib::Geoid & dl_geoid, dl_lattice_t & dl_lattice, le_size_t const dl_threads ) {
+
+        /* data pointer variable */
+        le_real_t const * dl_pose( nullptr );
+
+        /* boundary variable */
+        le_real_t dl_xmax( -std::numeric_limits < le_real_t >::max() );
+
+        /* boundary variable */
+        le_real_t dl_ymax( -std::numeric_limits < le_real_t >::max() );
+
+        /* deviation variable */
+        le_real_t dl_error( 0.0 );
+
+        /* check records */
+        if ( dl_count == 0 ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* initialise boundaries */
+        dl_lattice.lt_xmin = +std::numeric_limits < le_real_t >::max();
+
+        /* initialise boundaries */
+        dl_lattice.lt_ymin = +std::numeric_limits < le_real_t >::max();
+
+        /* parsing chunk vertex */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+            /* create data pointer */
+            dl_pose = ( le_real_t const * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA );
+
+            /* avoid non-finite vertex */
+            if ( ( std::isfinite( dl_pose[0] ) == false ) || ( std::isfinite( dl_pose[1] ) == false ) ) continue;
+
+            /* update boundaries */
+            dl_lattice.lt_xmin = std::min( dl_lattice.lt_xmin, dl_pose[0] );
+            dl_lattice.lt_ymin = std::min( dl_lattice.lt_ymin, dl_pose[1] );
+
+            /* update boundaries */
+            dl_xmax = std::max( dl_xmax, dl_pose[0] );
+            dl_ymax = std::max( dl_ymax, dl_pose[1] );
+
+        }
+
+        /* check boundaries */
+        if ( ( std::isfinite( dl_xmax - dl_lattice.lt_xmin ) == false ) || ( std::isfinite( dl_ymax - dl_lattice.lt_ymin ) == false ) ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* compute lattice step - radian */
+        dl_lattice.lt_step = ( dl_geoid.Interval() / LE_R2D ) / DL_LATTICE_REFINE;
+
+        /* compute lattice size */
+        dl_lattice.lt_width  = le_size_t( ( dl_xmax - dl_lattice.lt_xmin ) / dl_lattice.lt_step ) + 2;
+        dl_lattice.lt_height = le_size_t( ( dl_ymax - dl_lattice.lt_ymin ) / dl_lattice.lt_step ) + 2;
+
+        /* check lattice size */
+        if ( ( dl_lattice.lt_width * dl_lattice.lt_height ) > dl_count ) {
+
+            /* send message */
+            return( false );
+
+        }
+
+        /* update lattice size */
+        dl_lattice.lt_grid.resize( dl_lattice.lt_width * dl_lattice.lt_height );
+
+        /* parsing lattice rows */
+        lc_thread( dl_lattice.lt_height, dl_threads, [&] ( le_size_t const dl_row ) {
+
+            /* row latitude variable - degree */
+            le_real_t dl_lat( std::min( ( dl_lattice.lt_ymin + dl_row * dl_lattice.lt_step ) * LE_R2D, 90.0 ) );
+
+            /* parsing lattice columns */
+            for ( le_size_t dl_column( 0 ); dl_column < dl_lattice.lt_width; dl_column ++ ) {
+
+                /* compute lattice node */
+                dl_lattice.lt_grid[dl_row * dl_lattice.lt_width + dl_column] = dl_geoid( dl_lat, ( dl_lattice.lt_xmin + dl_column * dl_lattice.lt_step ) * LE_R2D );
+
+            }
+
+        } );
+
+        /* parsing control vertex - at least one controlled vertex */
+        for ( le_size_t dl_parse( std::min( le_size_t( DL_LATTICE_CHECK / 2 ), dl_count - 1 ) ); dl_parse < dl_count; dl_parse += DL_LATTICE_CHECK ) {
+
+            /* create data pointer */
+            dl_pose = ( le_real_t const * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA );
+
+            /* avoid non-finite vertex */
+            if ( ( std::isfinite( dl_pose[0] ) == false ) || ( std::isfinite( dl_pose[1] ) == false ) ) continue;
+
+            /* update deviation */
+            dl_error = std::max( dl_error, std::fabs( dl_geoid_bilinear( dl_lattice, dl_pose[0], dl_pose[1] ) - dl_geoid( dl_pose[1] * LE_R2D, dl_pose[0] * LE_R2D ) ) );
+
+        }
+
+        /* send message */
+        return( dl_error <= DL_LATTICE_TOLERANCE );
+
+    }
+
+/*
+    source - interpolation methods
+ */
+
+    le_real_t dl_geoid_bilinear( dl_lattice_t const & dl_lattice, le_real_t const dl_x, le_real_t const dl_y ) {
+
+        /* lattice coordinates variable */
+        le_real_t dl_fx( ( dl_x - dl_lattice.lt_xmin ) / dl_lattice.lt_step );
+        le_real_t dl_fy( ( dl_y - dl_lattice.lt_ymin ) / dl_lattice.lt_step );
+
+        /* lattice cell variable */
+        le_size_t dl_ix( std::min( le_size_t( dl_fx ), dl_lattice.lt_width  - 2 ) );
+        le_size_t dl_iy( std::min( le_size_t( dl_fy ), dl_lattice.lt_height - 2 ) );
+
+        /* lattice cell pointer variable */
+        le_real_t const * dl_node( dl_lattice.lt_grid.data() + dl_iy * dl_lattice.lt_width + dl_ix );
+
+        /* cell coordinates */
+        dl_fx -= dl_ix;
+        dl_fy -= dl_iy;
+
+        /* send interpolated undulation */
+        return( ( 1.0 - dl_fy ) * ( ( 1.0 - dl_fx ) * dl_node[0] + dl_fx * dl_node[1] ) + dl_fy * ( ( 1.0 - dl_fx ) * dl_node[dl_lattice.lt_width] + dl_fx * dl_node[dl_lattice.lt_width + 1] ) );
+
+    }
+
+    le_void_t dl_geoid_interpolate( le_byte_t * const dl_buffer, le_size_t const dl_head, le_size_t const dl_tail, dl_lattice_t const & dl_lattice, le_real_t const dl_conversion ) {
+
+        /* block coordinates variable */
+        le_real_t dl_x[DL_LATTICE_BLOCK];
+        le_real_t dl_y[DL_LATTICE_BLOCK];
+
+        /* block undulation variable */
+        le_real_t dl_u[DL_LATTICE_BLOCK];
+
+        /* block validity variable */
+        le_real_t dl_v[DL_LATTICE_BLOCK];
+
+        /* block size variable */
+        le_size_t dl_size( 0 );
+
+        /* parsing vertex blocks */
+        for ( le_size_t dl_block( dl_head ); dl_block < dl_tail; dl_block += dl_size ) {
+
+            /* compute block size */
+            dl_size = std::min( dl_tail - dl_block, le_size_t( DL_LATTICE_BLOCK ) );
+
+            /* gather block coordinates */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_size; dl_parse ++ ) {
+
+                /* gather coordinates */
+                dl_x[dl_parse] = ( ( le_real_t * ) ( dl_buffer + ( dl_block + dl_parse ) * LE_ARRAY_DATA ) )[0];
+                dl_y[dl_parse] = ( ( le_real_t * ) ( dl_buffer + ( dl_block + dl_parse ) * LE_ARRAY_DATA ) )[1];
+
+                /* check coordinates */
+                if ( ( std::isfinite( dl_x[dl_parse] ) == true ) && ( std::isfinite( dl_y[dl_parse] ) == true ) ) {
+
+                    /* valid vertex */
+                    dl_v[dl_parse] = 1.0;
+
+                } else {
+
+                    /* replace coordinates - lattice origin */
+                    dl_x[dl_parse] = dl_lattice.lt_xmin;
+                    dl_y[dl_parse] = dl_lattice.lt_ymin;
+
+                    /* non-finite vertex - left untouched */
+                    dl_v[dl_parse] = 0.0;
+
+                }
+
+            }
+
+            /* interpolate block undulations */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_size; dl_parse ++ ) {
+
+                /* interpolate undulation */
+                dl_u[dl_parse] = dl_geoid_bilinear( dl_lattice, dl_x[dl_parse], dl_y[dl_parse] );
+
+            }
+
+            /* scatter block heights */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_size; dl_parse ++ ) {
+
+                /* vertex conversion */
+                ( ( le_real_t * ) ( dl_buffer + ( dl_block + dl_parse ) * LE_ARRAY_DATA ) )[2] += dl_conversion * dl_u[dl_parse] * dl_v[dl_parse];
+
+            }
+
+        }
 
     }
 
@@ -97,7 +315,25 @@
     source - batch methods
  */
 
-    le_void_t dl_geoid_batch( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion ) {
+    le_void_t dl_geoid_batch( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion, le_size_t const dl_threads, le_size_t const dl_jobs, bool const dl_exact ) {
+
+        /* files variable */
+        std::vector < dl_file_t > dl_files;
+
+        /* file variable */
+        dl_file_t dl_file;
+
+        /* progress mutex variable */
+        std::mutex dl_mutex;
+
+        /* progress variable */
+        le_size_t dl_done( 0 );
+
+        /* progress variable */
+        le_size_t dl_bytes( 0 );
+
+        /* status variable */
+        struct stat dl_status;
 
         /* directory variable */
         DIR * dl_directory( nullptr );
@@ -111,6 +347,12 @@
         /* string conversion */
         std::string dl_outbase( ( char * ) dl_output );
 
+        /* file threads variable */
+        le_size_t dl_share( std::max( dl_threads / dl_jobs, le_size_t( 1 ) ) );
+
+        /* timing variable */
+        std::chrono::steady_clock::time_point dl_start( std::chrono::steady_clock::now() );
+
         /* check consistency */
         if ( ( dl_directory = opendir( ( char * ) dl_input ) ) == nullptr ) {
 
@@ -129,10 +371,27 @@
                 std::string dl_name( dl_entity->d_name );
 
                 /* filter on extension */
-                if ( dl_name.substr( dl_name.length() - 4, 4 ) == ".uv3" ) {
+                if ( dl_name.length() >= 4 && dl_name.substr( dl_name.length() - 4, 4 ) == ".uv3" ) {
+
+                    /* retrieve file status */
+                    if ( stat( ( dl_inbase + "/" + dl_name ).c_str(), & dl_status ) != 0 ) {
+
+                        /* close directory */
+                        closedir( dl_directory );
+
+                        /* send message */
+                        throw( LC_ERROR_IO_ACCESS );
+
+                    }
+
+                    /* assign file name */
+                    dl_file.fl_name = dl_name;
 
-                    /* process file */
-                    dl_geoid_height( ( le_char_t * ) ( dl_inbase + "/" + dl_name ).c_str(), ( le_char_t * ) ( dl_outbase + "/" + dl_name ).c_str(), dl_geoid, dl_conversion );
+                    /* assign file size */
+                    dl_file.fl_size = dl_status.st_size;
+
+                    /* push file */
+                    dl_files.push_back( dl_file );
 
                 }
 
@@ -143,6 +402,56 @@
         /* close directory */
         closedir( dl_directory );
 
+        /* sort files by decreasing size */
+        std::sort( dl_files.begin(), dl_files.end(), [] ( dl_file_t const & dl_a, dl_file_t const & dl_b ) {
+
+            /* compare sizes */
+            return( dl_a.fl_size > dl_b.fl_size );
+
+        } );
+
+        /* processing files */
+        lc_thread( dl_files.size(), dl_jobs, [ & ] ( le_size_t const dl_index ) {
+
+            /* process file */
+            dl_geoid_height( ( le_char_t * ) ( dl_inbase + "/" + dl_files[dl_index].fl_name ).c_str(), ( le_char_t * ) ( dl_outbase + "/" + dl_files[dl_index].fl_name ).c_str(), dl_geoid, dl_conversion, dl_share, dl_exact );
+
+            /* lock progress */
+            std::lock_guard < std::mutex > dl_lock( dl_mutex );
+
+            /* update progress */
+            dl_bytes += dl_files[dl_index].fl_size;
+
+            /* display progress */
+            dl_geoid_progress( ++ dl_done, dl_files.size(), dl_bytes, dl_start );
+
+        } );
+
+        /* check progress */
+        if ( dl_done > 0 ) {
+
+            /* terminate progress */
+            std::cerr << std::endl;
+
+        }
+
+    }
+
+/*
+    source - progress methods
+ */
+
+    le_void_t dl_geoid_progress( le_size_t const dl_done, le_size_t const dl_count, le_size_t const dl_bytes, std::chrono::steady_clock::time_point const & dl_start ) {
+
+        /* elapsed time variable */
+        le_real_t dl_time( std::chrono::duration < le_real_t > ( std::chrono::steady_clock::now() - dl_start ).count() );
+
+        /* megabytes variable */
+        le_real_t dl_mega( le_real_t( dl_bytes ) / 1048576.0 );
+
+        /* display progress */
+        std::cerr << "\rdalai-geoid : " << dl_done << "/" << dl_count << " files, " << std::fixed << std::setprecision( 1 ) << dl_mega << " MB, " << ( dl_time > 0.0 ? dl_mega / dl_time : 0.0 ) << " MB/s" << std::flush;
+
     }
 
 /*
@@ -163,14 +472,23 @@
         /* i/o path variable */
         le_char_t * dl_output = ( le_char_t * ) lc_read_string( argc, argv, "--output", "-o" );
 
+        /* threads variable */
+        le_size_t dl_threads( lc_thread_count( lc_read_unsigned( argc, argv, "--threads", "-t", 0 ) ) );
+
+        /* jobs variable */
+        le_size_t dl_jobs( lc_thread_count( lc_read_unsigned( argc, argv, "--jobs", "-j", 1 ) ) );
+
+        /* interpolation variable */
+        bool dl_exact( lc_read_flag( argc, argv, "--exact", "-x" ) );
+
         /* conversion variable */
         le_real_t dl_conversion( +1.0 );
 
     /* error management */
     try {
 
-        /* geolib geoid variable */
-        GeographicLib::Geoid dl_geoid( std::string( ( char * ) dl_name ), std::string( ( char * ) dl_path ), true );
+        /* geolib geoid variable (thread-safe when threaded) */
+        GeographicLib::Geoid dl_geoid( std::string( ( char * ) dl_name ), std::string( ( char * ) dl_path ), true, ( dl_threads > 1 ) || ( dl_jobs > 1 ) );
 
         /* conversion detection */
         if ( lc_read_flag( argc, argv, "--to-msl", "-m" ) == true ) {
@@ -197,7 +515,7 @@
             }
 
             /* batch processing */
-            dl_geoid_batch( dl_input, dl_output, dl_geoid, dl_conversion );
+            dl_geoid_batch( dl_input, dl_output, dl_geoid, dl_conversion, dl_threads, dl_jobs, dl_exact );
 
         } else {
 
@@ -210,7 +528,7 @@
             }
 
             /* process file */
-            dl_geoid_height( dl_input, dl_output, dl_geoid, dl_conversion );
+            dl_geoid_height( dl_input, dl_output, dl_geoid, dl_conversion, dl_threads, dl_exact );
 
         }
 
@@ -54,7 +54,16 @@
 
     # include <iostream>
     # include <fstream>
+    # include <iomanip>
+    # include <cmath>
+    # include <limits>
+    # include <string>
+    # include <vector>
+    # include <algorithm>
+    # include <mutex>
+    # include <chrono>
     # include <sys/types.h>
+    # include <sys/stat.h>
     # include <dirent.h>
     # include <common-include.hpp>
     # include <eratosthene-include.h>
@@ -68,8 +77,20 @@
     header - preprocessor macros
  */
 
-    /* define data chunk */
-    # define DL_CHUNK ( le_size_l( 37449 ) * LE_ARRAY_DATA )
+    /* define data chunk - records */
+    # define DL_CHUNK ( le_size_l( 37449 ) )
+
+    /* define lattice refinement - nodes per geoid grid interval */
+    # define DL_LATTICE_REFINE ( 4.0 )
+
+    /* define lattice control - records between control vertex */
+    # define DL_LATTICE_CHECK ( 64 )
+
+    /* define lattice tolerance - metre */
+    # define DL_LATTICE_TOLERANCE ( 1e-3 )
+
+    /* define lattice interpolation block - records */
+    # define DL_LATTICE_BLOCK ( 256 )
 
 /*
     header - type definition
@@ -79,6 +100,58 @@
     header - structures
  */
 
+    /*! \struct dl_file_t
+     *  \brief batch file structure
+     *
+     *  This structure holds the description of an uv3 file waiting to be
+     *  converted in batch mode.
+     *
+     *  \var dl_file_t::fl_name
+     *  File name, relative to the input directory
+     *  \var dl_file_t::fl_size
+     *  File size, in bytes
+     */
+
+    struct dl_file_t {
+
+        std::string fl_name;
+        le_size_t   fl_size;
+
+    };
+
+    /*! \struct dl_lattice_t
+     *  \brief undulation lattice structure
+     *
+     *  This structure holds a regular lattice of geoid undulations covering
+     *  the bounding box of a chunk of vertex. The lattice nodes are computed
+     *  through the geoid model and the undulation of the vertex are then
+     *  obtained by bilinear interpolation of the nodes.
+     *
+     *  \var dl_lattice_t::lt_grid
+     *  Lattice undulations, row-major, metre
+     *  \var dl_lattice_t::lt_xmin
+     *  Lattice first node longitude, radian
+     *  \var dl_lattice_t::lt_ymin
+     *  Lattice first node latitude, radian
+     *  \var dl_lattice_t::lt_step
+     *  Lattice nodes spacing, radian
+     *  \var dl_lattice_t::lt_width
+     *  Lattice number of nodes along longitude
+     *  \var dl_lattice_t::lt_height
+     *  Lattice number of nodes along latitude
+     */
+
+    struct dl_lattice_t {
+
+        std::vector < le_real_t > lt_grid;
+        le_real_t                 lt_xmin;
+        le_real_t                 lt_ymin;
+        le_real_t                 lt_step;
+        le_size_t                 lt_width;
+        le_size_t                 lt_height;
+
+    };
+
 /*
     header - function prototypes
  */
@@ -97,13 +170,92 @@
      *  The conversion flag has to be +1.0 for MSL to ellipsoidal height
      *  conversion and -1.0 for the invert conversion.
      *
+     *  The input stream is read by chunks of DL_CHUNK records. The records of
+     *  each chunk are split in equal slices converted by the provided number of
+     *  threads, the geoid structure having to be thread-safe when more than a
+     *  single thread is used.
+     *
+     *  Unless the exact flag is set, an undulation lattice is computed over
+     *  each chunk and the vertex undulations are interpolated in it (see
+     *  dl_geoid_lattice() function). The geoid model is directly evaluated for
+     *  each vertex of the chunks for which no lattice is available. The vertex
+     *  with non-finite coordinates are left untouched.
+     *
      *  \param dl_input      Input stream path (file)
      *  \param dl_output     Output stream path (file)
      *  \param dl_geoid      Geoid structure (GeographicLib)
      *  \param dl_conversion Conversion mode value (+1.0 or -1.0)
+     *  \param dl_threads    Number of threads
+     *  \param dl_exact      Direct geoid evaluation flag
+     */
+
+    le_void_t dl_geoid_height( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion, le_size_t const dl_threads, bool const dl_exact );
+
+    /*! \brief lattice methods
+     *
+     *  This function computes the undulation lattice covering the bounding box
+     *  of the provided chunk of records. The lattice spacing is the interval of
+     *  the geoid model grid divided by DL_LATTICE_REFINE and its nodes are
+     *  evaluated through the geoid model, by rows distributed over the provided
+     *  number of threads.
+     *
+     *  The lattice is then controlled on one vertex every DL_LATTICE_CHECK, and
+     *  at least on the last vertex of smaller chunks, by comparing its
+     *  interpolated undulation to the one computed by the geoid model. If the
+     *  largest deviation exceeds DL_LATTICE_TOLERANCE, the lattice is rejected.
+     *
+     *  The vertex with non-finite coordinates are ignored by the bounding box
+     *  and the controls.
+     *
+     *  The lattice is also rejected when it would hold more nodes than the
+     *  chunk holds records, as the direct evaluation is then cheaper.
+     *
+     *  \param dl_buffer  Chunk records buffer
+     *  \param dl_count   Chunk number of records
+     *  \param dl_geoid   Geoid structure (GeographicLib)
+     *  \param dl_lattice Lattice structure
+     *  \param dl_threads Number of threads
+     *
+     *  \return Returns true if the lattice can be used, false otherwise
+     */
+
+    bool dl_geoid_lattice( le_byte_t const * const dl_buffer, le_size_t const dl_count, GeographicLib::Geoid & dl_geoid, dl_lattice_t & dl_lattice, le_size_t const dl_threads );
+
+    /*! \brief interpolation methods
+     *
+     *  This function computes the undulation at the provided position through
+     *  bilinear interpolation of the lattice nodes. The position has to lie in
+     *  the bounding box covered by the lattice.
+     *
+     *  \param dl_lattice Lattice structure
+     *  \param dl_x       Position longitude, radian
+     *  \param dl_y       Position latitude, radian
+     *
+     *  \return Returns interpolated undulation
+     */
+
+    le_real_t dl_geoid_bilinear( dl_lattice_t const & dl_lattice, le_real_t const dl_x, le_real_t const dl_y );
+
+    /*! \brief interpolation methods
+     *
+     *  This function applies the height conversion on the records of the
+     *  provided range of the chunk using the undulations interpolated in the
+     *  provided lattice.
+     *
+     *  The records are processed by blocks of DL_LATTICE_BLOCK : coordinates
+     *  are first gathered in contiguous arrays, interpolated by a branchless
+     *  loop the compiler is able to vectorise, and the heights are updated.
+     *  The records with non-finite coordinates are interpolated at the lattice
+     *  origin and their height is left untouched.
+     *
+     *  \param dl_buffer     Chunk records buffer
+     *  \param dl_head       Range first record index
+     *  \param dl_tail       Range last record index, excluded
+     *  \param dl_lattice    Lattice structure
+     *  \param dl_conversion Conversion mode value (+1.0 or -1.0)
      */
 
-    le_void_t dl_geoid_height( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion );
+    le_void_t dl_geoid_interpolate( le_byte_t * const dl_buffer, le_size_t const dl_head, le_size_t const dl_tail, dl_lattice_t const & dl_lattice, le_real_t const dl_conversion );
 
     /*! \brief batch methods
      *
@@ -115,6 +267,12 @@
      *  name. Then, both input and output provided path have to point to valid
      *  directories.
      *
+     *  The listed files are sorted by decreasing size and distributed over the
+     *  provided number of jobs, converting files concurrently. The provided
+     *  number of threads is shared between the jobs for the conversion of each
+     *  file. The progress and throughput are reported on the error stream as
+     *  the files are converted.
+     *
      *  The conversion flag has to be +1.0 for MSL to ellipsoidal height
      *  conversion and -1.0 for the invert conversion.
      *
@@ -122,9 +280,26 @@
      *  \param dl_output     Output stream path (directory)
      *  \param dl_geoid      Geoid structure (GeographicLib)
      *  \param dl_conversion Conversion mode value (+1.0 or -1.0)
+     *  \param dl_threads    Number of threads
+     *  \param dl_jobs       Number of concurrent files
+     *  \param dl_exact      Direct geoid evaluation flag
+     */
+
+    le_void_t dl_geoid_batch( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion, le_size_t const dl_threads, le_size_t const dl_jobs, bool const dl_exact );
+
+    /*! \brief progress methods
+     *
+     *  This function displays, on the error stream, the progress of the batch
+     *  conversion. The number of converted files and bytes is displayed with
+     *  the throughput computed since the provided starting time.
+     *
+     *  \param dl_done  Number of converted files
+     *  \param dl_count Number of files
+     *  \param dl_bytes Number of converted bytes
+     *  \param dl_start Batch starting time
      */
 
-    le_void_t dl_geoid_batch( le_char_t const * const dl_input, le_char_t const * const dl_output, GeographicLib::Geoid & dl_geoid, le_real_t const dl_conversion );
+    le_void_t dl_geoid_progress( le_size_t const dl_done, le_size_t const dl_count, le_size_t const dl_bytes, std::chrono::steady_clock::time_point const & dl_start );
 
     /*! \brief main methods
      *
@@ -137,6 +312,9 @@
      *                    --output/-o [output directive]
      *                    --to-msl/-m [correction directive]
      *                    --to-ell/-e [correction directive]
+     *                    --threads/-t [number of threads]
+     *                    --jobs/-j [number of concurrent files]
+     *                    --exact/-x [direct geoid evaluation switch]
      *
      *  The geoid model used to apply the height correction on the vertex is
      *  expected to be in PGM format (see GeographicLib for more information).
@@ -151,7 +329,9 @@
      *  uv3 files hold in the directory and process each of them. The output
      *  directive has to point to another directory in which the converted uv3
      *  files are exported. The name of the input files is kept to name the
-     *  output files in such case.
+     *  output files in such case. The files are converted concurrently by the
+     *  specified number of jobs, one by default, zero meaning the number of
+     *  hardware threads.
      *
      *  If the '--to-msl' conversion directive is provided, the vertex heights
      *  are converted from ellipsoidal height to MSL height. If the '--to-ell'
@@ -163,7 +343,17 @@
      *  adapted to this datum.
      *
      *  Finally, the longitudes and latitudes of the uv3 files are expected to
-     *  be angles expressed in radian. 
+     *  be angles expressed in radian.
+     *
+     *  The conversion of each file is performed by the specified number of
+     *  threads, zero meaning the number of hardware threads. When more than a
+     *  single thread or job is used, the geoid model is entirely loaded in memory
+     *  in order to be shared by the threads.
+     *
+     *  By default, the undulations are interpolated in lattices computed on the
+     *  area covered by each chunk of vertex, the lattices being controlled
+     *  against the geoid model. The '--exact' switch forces the evaluation of
+     *  the geoid model for each vertex.
      *
      *  \param  argc Standard parameter
      *  \param  argv Standard parameter
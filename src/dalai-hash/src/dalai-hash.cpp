@@ -33,34 +33,41 @@
         /* hashing variable */
         le_real_t dl_param( lc_read_double( argc, argv, "--parameter", "-p", 250.0 ) );
 
+        /* hashing mode variable */
+        char * dl_mode( lc_read_string( argc, argv, "--hash-mode", "-m" ) );
+
+        /* memory budget variable */
+        le_size_t dl_budget( lc_read_unsigned( argc, argv, "--budget", "-b", DL_HASH_BUDGET ) );
+
         /* minimum distance mean variable */
         le_real_t dl_mean( 0.0 );
 
-        /* input variable */
-        std::ifstream dl_istream;
-
     /* error management */
     try {
 
-        /* create stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
+        /* create stream reader */
+        lc_uv3_t dl_istream( lc_read_string( argc, argv, "--input", "-i" ) );
 
-        /* check stream */
-        if ( dl_istream.is_open() == false ) {
+        /* compute mean value */
+        dl_mean = lc_statistic_mdmv( dl_istream, dl_count );
 
-            /* send message */
-            throw( LC_ERROR_IO_READ );
+        /* check hashing mode */
+        if ( ( dl_mode == nullptr ) || ( strcmp( dl_mode, "stream" ) == 0 ) ) {
 
-        }
+            /* model hashing */
+            lc_hash( dl_istream, ( le_char_t * ) lc_read_string( argc, argv, "--output", "-o" ), dl_param, dl_mean );
 
-        /* compute mean value */
-        dl_mean = lc_statistic_mdmv( dl_istream, dl_count );
+        } else if ( strcmp( dl_mode, "bucket" ) == 0 ) {
+
+            /* model hashing - memory budget in megabytes */
+            lc_hash_bucket( dl_istream, ( le_char_t * ) lc_read_string( argc, argv, "--output", "-o" ), dl_param, dl_mean, dl_budget * 1024 * 1024 );
 
-        /* model hashing */
-        lc_hash( dl_istream, ( le_char_t * ) lc_read_string( argc, argv, "--output", "-o" ), dl_param, dl_mean );
+        } else {
 
-        /* delete stream */
-        dl_istream.close();
+            /* send message */
+            throw( LC_ERROR_DOMAIN );
+
+        }
 
     /* error management */
     } catch ( int dl_code ) {
@@ -61,6 +61,9 @@
     header - preprocessor definitions
  */
 
+    /* define bucket mode memory budget, in megabytes */
+    # define DL_HASH_BUDGET ( 1024 )
+
 /*
     header - preprocessor macros
  */
@@ -86,6 +89,8 @@
      *                   --output/-o [output path directory]
      *                   --count/-c [sampled elements count]
      *                   --parameter/-p [hashing parameter]
+     *                   --hash-mode/-m [hashing mode : stream, bucket]
+     *                   --budget/-b [bucket mode memory budget, in MB]
      *
      *  The functions starts by gathering the parameters and opens the provided
      *  input file. It computes the file model minimum distances mean value and
@@ -102,6 +107,12 @@
      *  to compute the minimum distances mean value. The hashing parameter is
      *  used with the mean value to determine the size of the sub-files.
      *
+     *  The hashing mode selects the way the sub-files are written. The default
+     *  stream mode writes the records as they are read using \b lc_hash(). The
+     *  bucket mode uses \b lc_hash_bucket() to write each sub-file at once if
+     *  the input file fits in the provided memory budget, falling back to the
+     *  stream mode otherwise.
+     *
      *  \param  argc Standard parameter
      *  \param  argv Standard parameter
      *
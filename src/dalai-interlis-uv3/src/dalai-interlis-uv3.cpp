@@ -19,129 +19,289 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+
     # include "dalai-interlis-uv3.hpp"
 
 /*
-    source - buffer methods
+    source - layer methods
  */
 
-    void dl_interlis_init( le_byte_t * dl_buffer, le_byte_t const dl_red, le_byte_t const dl_green, le_byte_t const dl_blue ) {
+    void dl_interlis_layer( char const * const dl_string, dl_layer_t & dl_layer ) {
 
-        /* buffer pointer variable */
-        le_real_t * dl_pose( NULL );
+        /* fields variable */
+        std::string dl_field[5];
 
-        /* assign position pointer */
-        dl_pose = ( le_real_t * ) dl_buffer;
+        /* field index variable */
+        le_size_t dl_index( 0 );
 
-        /* initialise position */
-        dl_pose[0] = 0.0;
-        dl_pose[1] = 0.0;
-        dl_pose[2] = 0.0;
+        /* parsing description */
+        for ( char const * dl_parse( dl_string ); ( * dl_parse ) != '\0'; dl_parse ++ ) {
+
+            /* check separator */
+            if ( ( * dl_parse ) == ',' ) {
+
+                /* check consistency */
+                if ( ( ++ dl_index ) >= 5 ) {
+
+                    /* send message */
+                    throw( LC_ERROR_FORMAT );
+
+                }
+
+            } else {
+
+                /* update field */
+                dl_field[dl_index] += ( * dl_parse );
+
+            }
+
+        }
+
+        /* check consistency */
+        if ( ( dl_field[0].empty() == true ) || ( dl_field[1].empty() == true ) ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* assign layer target */
+        dl_layer.ly_topic = dl_field[0];
+        dl_layer.ly_table = dl_field[1];
+
+        /* parsing color components */
+        for ( le_size_t dl_parse( 0 ); dl_parse < 3; dl_parse ++ ) {
 
-        /* assign data pointer */
-        dl_buffer += LE_ARRAY_DATA_POSE;
+            /* component variable */
+            std::string const & dl_component( dl_field[dl_parse + 2] );
 
-        /* initialise type */
-        dl_buffer[0] = 2;
+            /* check consistency */
+            if ( ( dl_component.size() > 3 ) || ( dl_component.find_first_not_of( "0123456789" ) != std::string::npos ) ) {
 
-        /* initialise color */
-        dl_buffer[1] = dl_red;
-        dl_buffer[2] = dl_green;
-        dl_buffer[3] = dl_blue;
+                /* send message */
+                throw( LC_ERROR_FORMAT );
+
+            }
+
+            /* convert component */
+            le_size_t dl_value( dl_component.empty() ? 0 : std::stoul( dl_component ) );
+
+            /* check consistency */
+            if ( dl_value > 255 ) {
+
+                /* send message */
+                throw( LC_ERROR_FORMAT );
+
+            }
+
+            /* assign layer color */
+            dl_layer.ly_color[dl_parse] = dl_value;
+
+        }
 
     }
 
-    void dl_interlis_export( le_byte_t * const dl_buffer, std::ofstream & dl_stream, le_real_t const dl_x, le_real_t const dl_y ) {
+/*
+    source - buffer methods
+ */
+
+    void dl_interlis_export( dl_output_t & dl_output, le_data_t const * const dl_color, le_real_t const dl_x, le_real_t const dl_y ) {
+
+        /* record pointer variable */
+        le_byte_t * dl_record( dl_output.ot_buffer + dl_output.ot_size );
+
+        /* check output mode */
+        if ( dl_output.ot_buffer == nullptr ) {
+
+            /* push record */
+            dl_output.ot_spill.resize( dl_output.ot_spill.size() + LE_ARRAY_DATA );
+
+            /* assign record pointer */
+            dl_record = dl_output.ot_spill.data() + dl_output.ot_spill.size() - LE_ARRAY_DATA;
+
+        }
 
         /* buffer pointer variable */
-        le_real_t * dl_pose( NULL );
+        le_real_t * dl_pose( ( le_real_t * ) dl_record );
 
-        /* assign position pointer */
-        dl_pose = ( le_real_t * ) dl_buffer;
+        /* buffer pointer variable */
+        le_data_t * dl_data( ( le_data_t * ) ( dl_pose + 3 ) );
 
         /* assign position values */
         dl_pose[0] = dl_x;
         dl_pose[1] = dl_y;
+        dl_pose[2] = 0.0;
+
+        /* assign type */
+        dl_data[0] = 2;
+
+        /* assign color */
+        dl_data[1] = dl_color[0];
+        dl_data[2] = dl_color[1];
+        dl_data[3] = dl_color[2];
+
+        /* check output mode */
+        if ( dl_output.ot_buffer == nullptr ) return;
+
+        /* check buffer state */
+        if ( ( dl_output.ot_size += LE_ARRAY_DATA ) == ( DL_BUFFER * LE_ARRAY_DATA ) ) {
+
+            /* export buffer */
+            dl_interlis_flush( dl_output );
+
+        }
+
+    }
+
+    void dl_interlis_flush( dl_output_t & dl_output ) {
 
         /* export buffer */
-        dl_stream.write( ( char * ) dl_buffer, LE_ARRAY_DATA );
+        dl_output.ot_stream.write( ( char * ) dl_output.ot_buffer, dl_output.ot_size );
+
+        /* reset buffer */
+        dl_output.ot_size = 0;
 
     }
 
 /*
-    source - main methods
+    source - parsing methods
  */
 
-    int main( int argc, char ** argv ) {
+    char const * dl_interlis_token( char const * dl_parse, char const * const dl_tail, le_size_t & dl_length ) {
 
-        /* buffer variable */
-        le_byte_t dl_buffer[LE_ARRAY_DATA] = { 0 };
+        /* token variable */
+        char const * dl_token( nullptr );
 
-        /* target variable */
-        char * dl_target_topic( lc_read_string( argc, argv, "--topic", "-t" ) );
+        /* skip white spaces */
+        while ( ( dl_parse < dl_tail ) && ( ( ( * dl_parse ) == ' ' ) || ( ( ( * dl_parse ) >= '\t' ) && ( ( * dl_parse ) <= '\r' ) ) ) ) dl_parse ++;
 
-        /* target variable */
-        char * dl_target_table( lc_read_string( argc, argv, "--table", "-a" ) );
+        /* assign token position */
+        dl_token = dl_parse;
 
-        /* color variable */
-        le_byte_t dl_red( lc_read_unsigned( argc, argv, "--red", "-r", 0 ) );
+        /* search token end */
+        while ( ( dl_parse < dl_tail ) && ( ( * dl_parse ) != ' ' ) && ( ( ( * dl_parse ) < '\t' ) || ( ( * dl_parse ) > '\r' ) ) ) dl_parse ++;
 
-        /* color variable */
-        le_byte_t dl_green( lc_read_unsigned( argc, argv, "--green", "-g", 0 ) );
+        /* assign token length */
+        dl_length = dl_parse - dl_token;
 
-        /* color variable */
-        le_byte_t dl_blue( lc_read_unsigned( argc, argv, "--blue", "-b", 0 ) );
+        /* return token position */
+        return( dl_token );
 
-        /* coordinates variable */
-        le_real_t dl_push_x( 0.0 );
-        le_real_t dl_push_y( 0.0 );
+    }
 
-        /* coordinate variable */
-        le_real_t dl_read_x( 0.0 );
-        le_real_t dl_read_y( 0.0 );
+    bool dl_interlis_match( char const * const dl_token, le_size_t const dl_length, char const * const dl_word ) {
 
-        /* reading mode variable */
-        le_enum_t dl_mode( 0 );
+        /* compare token and word */
+        return( ( std::strncmp( dl_token, dl_word, dl_length ) == 0 ) && ( dl_word[dl_length] == '\0' ) );
 
-        /* reading token variable */
-        std::string dl_token;
+    }
 
-        /* input stream variable */
-        std::ifstream dl_istream;
+    le_real_t dl_interlis_real( char const * const dl_token, le_size_t const dl_length ) {
 
-        /* output stream variable */
-        std::ofstream dl_ostream;
+        /* token variable */
+        char dl_string[DL_TOKEN];
 
-    /* error management */
-    try {
+        /* value variable */
+        le_real_t dl_value( 0.0 );
+
+        /* check token length */
+        if ( ( dl_length == 0 ) || ( dl_length >= DL_TOKEN ) ) {
 
-        /* initialise buffer */
-        dl_interlis_init( dl_buffer, dl_red, dl_green, dl_blue );
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in );
+        /* copy token */
+        std::memcpy( dl_string, dl_token, dl_length );
 
-        /* check input stream */
-        if ( dl_istream.is_open() == false ) {
+        /* terminate token */
+        dl_string[dl_length] = '\0';
+
+        /* convert token */
+        if ( lc_parse_real( dl_string, dl_value ) == dl_string ) {
 
             /* send message */
-            throw( LC_ERROR_IO_READ );
+            throw( LC_ERROR_FORMAT );
 
         }
 
-        /* create output stream */
-        dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+        /* return converted value */
+        return( dl_value );
 
-        /* check output stream */
-        if ( dl_ostream.is_open() == false ) {
+    }
 
-            /* send message */
-            throw( LE_ERROR_IO_WRITE );
+    void dl_interlis_active( char const * const dl_topic, le_size_t const dl_tlength, char const * const dl_table, le_size_t const dl_length, std::vector < dl_layer_t > const & dl_layers, std::vector < le_size_t > & dl_active ) {
+
+        /* reset active layers */
+        dl_active.clear();
+
+        /* parsing layers */
+        for ( le_size_t dl_layer( 0 ); dl_layer < dl_layers.size(); dl_layer ++ ) {
+
+            /* token detection */
+            if ( dl_interlis_match( dl_topic, dl_tlength, dl_layers[dl_layer].ly_topic.c_str() ) == false ) continue;
+
+            /* token detection */
+            if ( dl_interlis_match( dl_table, dl_length, dl_layers[dl_layer].ly_table.c_str() ) == false ) continue;
+
+            /* push active layer */
+            dl_active.push_back( dl_layer );
 
         }
 
-        /* input stream reading */
-        while ( dl_istream >> dl_token ) {
+    }
+
+    void dl_interlis_parse( char const * const dl_head, char const * const dl_tail, char const * const dl_context, le_size_t const dl_clength, char const * const dl_ctable, le_size_t const dl_ctlength, std::vector < dl_layer_t > const & dl_layers, std::vector < dl_output_t > & dl_outputs ) {
+
+        /* parsing variable */
+        char const * dl_parse( dl_head );
+
+        /* token variable */
+        char const * dl_token( nullptr );
+
+        /* token variable */
+        le_size_t dl_length( 0 );
+
+        /* topic token variable */
+        char const * dl_topic( dl_context );
+
+        /* topic token variable */
+        le_size_t dl_tlength( dl_clength );
+
+        /* active layers variable */
+        std::vector < le_size_t > dl_active;
+
+        /* coordinates variable */
+        le_real_t dl_push_x( 0.0 );
+        le_real_t dl_push_y( 0.0 );
+
+        /* coordinate variable */
+        le_real_t dl_read_x( 0.0 );
+        le_real_t dl_read_y( 0.0 );
+
+        /* reading mode variable */
+        le_enum_t dl_mode( dl_context == nullptr ? 0 : 2 );
+
+        /* allocate active layers */
+        dl_active.reserve( dl_layers.size() );
+
+        /* check table context */
+        if ( ( dl_context != nullptr ) && ( dl_ctable != nullptr ) ) {
+
+            /* search active layers */
+            dl_interlis_active( dl_context, dl_clength, dl_ctable, dl_ctlength, dl_layers, dl_active );
+
+            /* update mode */
+            dl_mode = dl_active.empty() ? 2 : 4;
+
+        }
+
+        /* input data reading */
+        while ( ( dl_token = dl_interlis_token( dl_parse, dl_tail, dl_length ) ) < dl_tail ) {
+
+            /* update parsing position */
+            dl_parse = dl_token + dl_length;
 
             /* switch on read mode */
             switch ( dl_mode ) {
@@ -150,7 +310,7 @@
                 case ( 0 ) : {
 
                     /* token detection */
-                    if ( dl_token.compare( "TOPI" ) == 0 ) {
+                    if ( dl_interlis_match( dl_token, dl_length, "TOPI" ) == true ) {
 
                         /* update mode */
                         dl_mode = 1;
@@ -162,14 +322,24 @@
                 /* read mode */
                 case ( 1 ) : {
 
-                    /* token detection */
-                    if ( dl_token.compare( dl_target_topic ) == 0 ) {
+                    /* update mode */
+                    dl_mode = 0;
 
-                        /* update mode */
-                        dl_mode = 2;
+                    /* parsing layers */
+                    for ( le_size_t dl_layer( 0 ); dl_layer < dl_layers.size(); dl_layer ++ ) {
 
-                    /* update mode */
-                    } else { dl_mode = 0; }
+                        /* token detection */
+                        if ( dl_interlis_match( dl_token, dl_length, dl_layers[dl_layer].ly_topic.c_str() ) == true ) {
+
+                            /* update mode */
+                            dl_mode = 2;
+
+                        }
+
+                    }
+
+                    /* push topic token */
+                    dl_topic = dl_token, dl_tlength = dl_length;
 
                 } break;
 
@@ -177,13 +347,13 @@
                 case ( 2 ) : {
 
                     /* token detection */
-                    if ( dl_token.compare( "ETOP" ) == 0 ) {
+                    if ( dl_interlis_match( dl_token, dl_length, "ETOP" ) == true ) {
 
                         /* update mode */
                         dl_mode = 0;
 
                     } else
-                    if ( dl_token.compare( "TABL" ) == 0 ) {
+                    if ( dl_interlis_match( dl_token, dl_length, "TABL" ) == true ) {
 
                         /* update mode */
                         dl_mode = 3;
@@ -195,14 +365,11 @@
                 /* read mode */
                 case ( 3 ) :  {
 
-                    /* token detection */
-                    if ( dl_token.compare( dl_target_table ) == 0 ) {
-
-                        /* update mode */
-                        dl_mode = 4;
+                    /* search active layers */
+                    dl_interlis_active( dl_topic, dl_tlength, dl_token, dl_length, dl_layers, dl_active );
 
                     /* update mode */
-                    } else { dl_mode = 2; }
+                    dl_mode = dl_active.empty() ? 2 : 4;
 
                 } break;
 
@@ -210,25 +377,25 @@
                 case ( 4 ) : {
 
                     /* token detection */
-                    if ( dl_token.compare( "ETAB" ) == 0 ) {
+                    if ( dl_interlis_match( dl_token, dl_length, "ETAB" ) == true ) {
 
                         /* update mode */
                         dl_mode = 2;
 
                     } else
-                    if ( dl_token.compare( "STPT" ) == 0 ) {
+                    if ( dl_interlis_match( dl_token, dl_length, "STPT" ) == true ) {
 
                         /* update mode */
                         dl_mode = 5;
 
                     } else
-                    //if ( dl_token.compare( "ARCP" ) == 0 ) {
+                    //if ( dl_interlis_match( dl_token, dl_length, "ARCP" ) == true ) {
 
                         /* update mode */
                     //    dl_mode = 6;
 
                     //} else
-                    if ( dl_token.compare( "LIPT" ) == 0 ) {
+                    if ( dl_interlis_match( dl_token, dl_length, "LIPT" ) == true ) {
 
                         /* update mode */
                         dl_mode = 6;
@@ -241,13 +408,16 @@
                 case ( 5 ) : {
 
                     /* convert and push coordinate */
-                    dl_push_x = std::stod( dl_token );
+                    dl_push_x = dl_interlis_real( dl_token, dl_length );
 
                     /* read next token */
-                    dl_istream >> dl_token;
+                    dl_token = dl_interlis_token( dl_parse, dl_tail, dl_length );
+
+                    /* update parsing position */
+                    dl_parse = dl_token + dl_length;
 
                     /* convert and push coordinate */
-                    dl_push_y = std::stod( dl_token );
+                    dl_push_y = dl_interlis_real( dl_token, dl_length );
 
                     /* update mode */
                     dl_mode = 4;
@@ -258,19 +428,30 @@
                 case ( 6 ) : {
 
                     /* convert coordinate */
-                    dl_read_x = std::stod( dl_token );
+                    dl_read_x = dl_interlis_real( dl_token, dl_length );
 
                     /* read next token */
-                    dl_istream >> dl_token;
+                    dl_token = dl_interlis_token( dl_parse, dl_tail, dl_length );
+
+                    /* update parsing position */
+                    dl_parse = dl_token + dl_length;
 
                     /* convert coordinate */
-                    dl_read_y = std::stod( dl_token  );
+                    dl_read_y = dl_interlis_real( dl_token, dl_length );
 
-                    /* export buffer */
-                    dl_interlis_export( dl_buffer, dl_ostream, dl_push_x, dl_push_y );
+                    /* parsing active layers */
+                    for ( le_size_t dl_layer( 0 ); dl_layer < dl_active.size(); dl_layer ++ ) {
 
-                    /* export buffer */
-                    dl_interlis_export( dl_buffer, dl_ostream, dl_read_x, dl_read_y );
+                        /* layer variable */
+                        dl_layer_t const & dl_target( dl_layers[dl_active[dl_layer]] );
+
+                        /* export buffer */
+                        dl_interlis_export( dl_outputs[dl_target.ly_output], dl_target.ly_color, dl_push_x, dl_push_y );
+
+                        /* export buffer */
+                        dl_interlis_export( dl_outputs[dl_target.ly_output], dl_target.ly_color, dl_read_x, dl_read_y );
+
+                    }
 
                     /* push coordinates */
                     dl_push_x = dl_read_x;
@@ -285,11 +466,454 @@
 
         }
 
-        /* delete output stream */
-        dl_ostream.close();
+    }
+
+    void dl_interlis_scan( char const * const dl_head, char const * const dl_tail, std::vector < dl_layer_t > const & dl_layers, std::vector < dl_block_t > & dl_blocks ) {
+
+        /* line variable */
+        char const * dl_line( dl_head );
+
+        /* line variable */
+        char const * dl_next( nullptr );
+
+        /* token variable */
+        char const * dl_token( nullptr );
+
+        /* token variable */
+        le_size_t dl_length( 0 );
+
+        /* topic token variable */
+        char const * dl_topic( nullptr );
+
+        /* topic token variable */
+        le_size_t dl_tlength( 0 );
+
+        /* table token variable */
+        char const * dl_table( nullptr );
+
+        /* table token variable */
+        le_size_t dl_alength( 0 );
+
+        /* topic state variable */
+        bool dl_match( false );
+
+        /* block state variable */
+        bool dl_open( false );
+
+        /* parsing lines */
+        for ( ; dl_line < dl_tail; dl_line = dl_next ) {
+
+            /* search line end */
+            if ( ( dl_next = ( char const * ) std::memchr( dl_line, '\n', dl_tail - dl_line ) ) == nullptr ) {
+
+                /* assign line end */
+                dl_next = dl_tail;
+
+            } else {
+
+                /* update line end */
+                dl_next ++;
+
+            }
+
+            /* read line keyword */
+            dl_token = dl_interlis_token( dl_line, dl_next, dl_length );
+
+            /* check keyword */
+            if ( dl_length != 4 ) continue;
+
+            /* keyword detection */
+            if ( dl_interlis_match( dl_token, dl_length, "TABL" ) == true ) {
+
+                /* check block state */
+                if ( dl_open == true ) {
+
+                    /* close block */
+                    dl_blocks.back().bk_tail = dl_line;
+
+                }
+
+                /* reset block state */
+                dl_open = false;
+
+                /* check topic state */
+                if ( dl_match == false ) continue;
+
+                /* read table token */
+                dl_table = dl_interlis_token( dl_token + dl_length, dl_next, dl_alength );
+
+                /* parsing layers */
+                for ( le_size_t dl_layer( 0 ); dl_layer < dl_layers.size(); dl_layer ++ ) {
+
+                    /* token detection */
+                    if ( dl_interlis_match( dl_topic, dl_tlength, dl_layers[dl_layer].ly_topic.c_str() ) == false ) continue;
+
+                    /* token detection */
+                    if ( dl_interlis_match( dl_table, dl_alength, dl_layers[dl_layer].ly_table.c_str() ) == false ) continue;
+
+                    /* update block state */
+                    dl_open = true;
+
+                }
+
+                /* check block state */
+                if ( dl_open == false ) continue;
+
+                /* push block */
+                dl_blocks.push_back( { dl_line, dl_tail, dl_topic, dl_tlength, nullptr, 0 } );
+
+            } else
+            if ( dl_interlis_match( dl_token, dl_length, "STPT" ) == true ) {
+
+                /* check block state */
+                if ( dl_open == false ) continue;
+
+                /* check block size */
+                if ( le_size_t( dl_line - dl_blocks.back().bk_head ) < DL_BLOCK ) continue;
+
+                /* close block */
+                dl_blocks.back().bk_tail = dl_line;
+
+                /* push split block */
+                dl_blocks.push_back( { dl_line, dl_tail, dl_topic, dl_tlength, dl_table, dl_alength } );
+
+            } else
+            if ( ( dl_interlis_match( dl_token, dl_length, "TOPI" ) == true ) || ( dl_interlis_match( dl_token, dl_length, "ETOP" ) == true ) ) {
+
+                /* check block state */
+                if ( dl_open == true ) {
+
+                    /* close block */
+                    dl_blocks.back().bk_tail = dl_line;
+
+                }
+
+                /* reset states */
+                dl_open = dl_match = false;
+
+                /* check keyword */
+                if ( dl_token[0] == 'E' ) continue;
+
+                /* read topic token */
+                dl_topic = dl_interlis_token( dl_token + dl_length, dl_next, dl_tlength );
+
+                /* parsing layers */
+                for ( le_size_t dl_layer( 0 ); dl_layer < dl_layers.size(); dl_layer ++ ) {
+
+                    /* token detection */
+                    if ( dl_interlis_match( dl_topic, dl_tlength, dl_layers[dl_layer].ly_topic.c_str() ) == true ) {
+
+                        /* update topic state */
+                        dl_match = true;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+/*
+    source - main methods
+ */
+
+    int main( int argc, char ** argv ) {
+
+        /* input path variable */
+        char * dl_path( lc_read_string( argc, argv, "--input", "-i" ) );
+
+        /* output directory variable */
+        char * dl_directory( lc_read_string( argc, argv, "--directory", "-d" ) );
+
+        /* threads variable */
+        le_size_t dl_threads( lc_thread_count( lc_read_unsigned( argc, argv, "--threads", "-n", 0 ) ) );
+
+        /* layer description variable */
+        char * dl_string( nullptr );
+
+        /* input descriptor variable */
+        int dl_handle( -1 );
+
+        /* input status variable */
+        struct stat dl_status;
+
+        /* input mapping variable */
+        char * dl_data( nullptr );
+
+        /* input size variable */
+        le_size_t dl_size( 0 );
+
+        /* layers variable */
+        std::vector < dl_layer_t > dl_layers;
+
+        /* outputs variable */
+        std::vector < dl_output_t > dl_outputs;
+
+        /* blocks variable */
+        std::vector < dl_block_t > dl_blocks;
+
+        /* blocks outputs variable */
+        std::vector < std::vector < dl_output_t > > dl_locals;
+
+    /* error management */
+    try {
+
+        /* parsing layer arguments */
+        for ( int dl_parse( 0 ); ( dl_string = lc_read_nstring( argc, argv, "--layer", "-l", dl_parse ) ) != nullptr; dl_parse ++ ) {
+
+            /* push layer */
+            dl_layers.emplace_back();
+
+            /* decode layer */
+            dl_interlis_layer( dl_string, dl_layers.back() );
+
+        }
+
+        /* check layers */
+        if ( dl_layers.empty() == true ) {
+
+            /* target variable */
+            char * dl_target_topic( lc_read_string( argc, argv, "--topic", "-t" ) );
+
+            /* target variable */
+            char * dl_target_table( lc_read_string( argc, argv, "--table", "-a" ) );
+
+            /* check targets */
+            if ( ( dl_target_topic == nullptr ) || ( dl_target_table == nullptr ) ) {
+
+                /* send message */
+                throw( LC_ERROR_FORMAT );
+
+            }
+
+            /* push layer */
+            dl_layers.emplace_back();
+
+            /* assign layer target */
+            dl_layers.back().ly_topic = dl_target_topic;
+            dl_layers.back().ly_table = dl_target_table;
+
+            /* assign layer color */
+            dl_layers.back().ly_color[0] = lc_read_unsigned( argc, argv, "--red", "-r", 0 );
+            dl_layers.back().ly_color[1] = lc_read_unsigned( argc, argv, "--green", "-g", 0 );
+            dl_layers.back().ly_color[2] = lc_read_unsigned( argc, argv, "--blue", "-b", 0 );
+
+        }
+
+        /* check output mode */
+        if ( dl_directory != nullptr ) {
+
+            /* parsing layers */
+            for ( le_size_t dl_parse( 1 ); dl_parse < dl_layers.size(); dl_parse ++ ) {
+
+                /* parsing previous layers */
+                for ( le_size_t dl_index( 0 ); dl_index < dl_parse; dl_index ++ ) {
+
+                    /* check layer topic */
+                    if ( dl_layers[dl_index].ly_topic != dl_layers[dl_parse].ly_topic ) continue;
+
+                    /* check layer table */
+                    if ( dl_layers[dl_index].ly_table != dl_layers[dl_parse].ly_table ) continue;
+
+                    /* send message */
+                    throw( LC_ERROR_FORMAT );
+
+                }
+
+            }
+
+        }
+
+        /* create outputs */
+        dl_outputs = std::vector < dl_output_t > ( dl_directory == nullptr ? 1 : dl_layers.size() );
+
+        /* parsing outputs */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_outputs.size(); dl_parse ++ ) {
+
+            /* initialise output */
+            dl_outputs[dl_parse].ot_buffer = nullptr;
+            dl_outputs[dl_parse].ot_size   = 0;
+
+            /* allocate buffer memory */
+            if ( ( dl_outputs[dl_parse].ot_buffer = new ( std::nothrow ) le_byte_t[DL_BUFFER * LE_ARRAY_DATA] ) == nullptr ) {
+
+                /* send message */
+                throw( LC_ERROR_MEMORY );
+
+            }
+
+            /* check output mode */
+            if ( dl_directory == nullptr ) {
+
+                /* create output stream */
+                dl_outputs[dl_parse].ot_stream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+
+            } else {
+
+                /* create output stream */
+                dl_outputs[dl_parse].ot_stream.open( std::string( dl_directory ) + "/" + dl_layers[dl_parse].ly_topic + "_" + dl_layers[dl_parse].ly_table + ".uv3", std::ios::out | std::ios::binary );
+
+            }
+
+            /* check output stream */
+            if ( dl_outputs[dl_parse].ot_stream.is_open() == false ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+        }
+
+        /* parsing layers */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_layers.size(); dl_parse ++ ) {
+
+            /* assign layer output */
+            dl_layers[dl_parse].ly_output = ( dl_directory == nullptr ) ? 0 : dl_parse;
+
+        }
+
+        /* check input path */
+        if ( dl_path == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* create input descriptor */
+        if ( ( dl_handle = open( dl_path, O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* retrieve input status */
+        if ( fstat( dl_handle, & dl_status ) != 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* check input size */
+        if ( ( dl_size = dl_status.st_size ) > 0 ) {
+
+            /* map input */
+            if ( ( dl_data = ( char * ) mmap( nullptr, dl_size, PROT_READ, MAP_PRIVATE, dl_handle, 0 ) ) == MAP_FAILED ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_READ );
+
+            }
+
+            /* advise access pattern */
+            madvise( dl_data, dl_size, MADV_SEQUENTIAL );
+
+        }
+
+        /* check threads */
+        if ( dl_threads == 1 ) {
+
+            /* input data parsing */
+            dl_interlis_parse( dl_data, dl_data + dl_size, nullptr, 0, nullptr, 0, dl_layers, dl_outputs );
+
+        } else {
+
+            /* input data scanning */
+            dl_interlis_scan( dl_data, dl_data + dl_size, dl_layers, dl_blocks );
+
+            /* create blocks outputs */
+            dl_locals = std::vector < std::vector < dl_output_t > > ( dl_threads );
+
+            /* parsing blocks outputs */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_threads; dl_parse ++ ) {
+
+                /* create block outputs */
+                dl_locals[dl_parse] = std::vector < dl_output_t > ( dl_outputs.size() );
+
+                /* parsing block outputs */
+                for ( le_size_t dl_index( 0 ); dl_index < dl_outputs.size(); dl_index ++ ) {
+
+                    /* initialise output */
+                    dl_locals[dl_parse][dl_index].ot_buffer = nullptr;
+                    dl_locals[dl_parse][dl_index].ot_size   = 0;
+
+                }
+
+            }
+
+            /* parsing blocks groups */
+            for ( le_size_t dl_group( 0 ); dl_group < dl_blocks.size(); dl_group += dl_threads ) {
+
+                /* group size variable */
+                le_size_t dl_count( std::min( dl_threads, dl_blocks.size() - dl_group ) );
+
+                /* blocks data parsing */
+                lc_thread( dl_count, dl_threads, [&]( le_size_t dl_index ) {
+
+                    /* block variable */
+                    dl_block_t const & dl_block( dl_blocks[dl_group + dl_index] );
+
+                    /* block data parsing */
+                    dl_interlis_parse( dl_block.bk_head, dl_block.bk_tail, dl_block.bk_topic, dl_block.bk_length, dl_block.bk_table, dl_block.bk_tlength, dl_layers, dl_locals[dl_index] );
+
+                } );
+
+                /* parsing group blocks */
+                for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+                    /* parsing block outputs */
+                    for ( le_size_t dl_index( 0 ); dl_index < dl_outputs.size(); dl_index ++ ) {
+
+                        /* block output variable */
+                        dl_output_t & dl_local( dl_locals[dl_parse][dl_index] );
+
+                        /* export buffer */
+                        dl_interlis_flush( dl_outputs[dl_index] );
+
+                        /* export block records */
+                        dl_outputs[dl_index].ot_stream.write( ( char * ) dl_local.ot_spill.data(), dl_local.ot_spill.size() );
+
+                        /* reset block records */
+                        dl_local.ot_spill.clear();
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        /* parsing outputs */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_outputs.size(); dl_parse ++ ) {
+
+            /* export buffer */
+            dl_interlis_flush( dl_outputs[dl_parse] );
+
+            /* delete output stream */
+            dl_outputs[dl_parse].ot_stream.close();
+
+            /* release buffer memory */
+            delete [] dl_outputs[dl_parse].ot_buffer;
+
+        }
+
+        /* check mapping */
+        if ( dl_data != nullptr ) {
+
+            /* release mapping */
+            munmap( dl_data, dl_size );
+
+        }
 
-        /* delete input stream */
-        dl_istream.close();
+        /* delete input descriptor */
+        close( dl_handle );
 
     /* error management */
     } catch ( int dl_code ) {
@@ -55,6 +55,13 @@
     # include <iostream>
     # include <fstream>
     # include <string>
+    # include <cstring>
+    # include <vector>
+    # include <algorithm>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include <sys/mman.h>
     # include <common-include.hpp>
     # include <eratosthene-include.h>
 
@@ -62,6 +69,15 @@
     header - preprocessor definitions
  */
 
+    /* define output buffer - records */
+    # define DL_BUFFER ( 131072 )
+
+    /* define numerical token maximum length */
+    # define DL_TOKEN  ( 64 )
+
+    /* define block split size - bytes */
+    # define DL_BLOCK  ( 4194304 )
+
 /*
     header - preprocessor macros
  */
@@ -74,38 +90,255 @@
     header - structures
  */
 
+    /*! \struct dl_output_t
+     *  \brief output structure
+     *
+     *  This structure holds an output uv3 stream and the buffer through which
+     *  the uv3 records are exported.
+     *
+     *  If no buffer is allocated, the records are accumulated in memory in the
+     *  spill array instead of being exported in the stream. This allows blocks
+     *  of data to be converted concurrently before their records are exported
+     *  in order.
+     *
+     *  \var dl_output_t::ot_stream
+     *  Output stream
+     *  \var dl_output_t::ot_buffer
+     *  Records buffer
+     *  \var dl_output_t::ot_size
+     *  Size, in bytes, of the buffered records
+     *  \var dl_output_t::ot_spill
+     *  Records accumulated in memory, used when no buffer is allocated
+     */
+
+    struct dl_output_t {
+
+        std::ofstream ot_stream;
+        le_byte_t *   ot_buffer;
+        le_size_t     ot_size;
+
+        std::vector < le_byte_t > ot_spill;
+
+    };
+
+    /*! \struct dl_layer_t
+     *  \brief layer structure
+     *
+     *  This structure describes a layer to extract, that is a table of a topic,
+     *  with the color assigned to its records and the output through which its
+     *  records are exported.
+     *
+     *  \var dl_layer_t::ly_topic
+     *  Target topic
+     *  \var dl_layer_t::ly_table
+     *  Target table
+     *  \var dl_layer_t::ly_color
+     *  Color of the records
+     *  \var dl_layer_t::ly_output
+     *  Index of the layer output
+     */
+
+    struct dl_layer_t {
+
+        std::string ly_topic;
+        std::string ly_table;
+        le_data_t   ly_color[3];
+        le_size_t   ly_output;
+
+    };
+
+    /*! \struct dl_block_t
+     *  \brief block structure
+     *
+     *  This structure describes a table block of the INTERLIS data, starting
+     *  with its TABL line, with the token of the topic containing it.
+     *
+     *  A large table is split in several blocks : the following blocks start
+     *  on a STPT line inside the table and also carry the table token.
+     *
+     *  \var dl_block_t::bk_head
+     *  Block range head
+     *  \var dl_block_t::bk_tail
+     *  Block range tail
+     *  \var dl_block_t::bk_topic
+     *  Topic token position
+     *  \var dl_block_t::bk_length
+     *  Topic token length
+     *  \var dl_block_t::bk_table
+     *  Table token position, null pointer if the block starts with its TABL
+     *  \var dl_block_t::bk_tlength
+     *  Table token length
+     */
+
+    struct dl_block_t {
+
+        char const * bk_head;
+        char const * bk_tail;
+        char const * bk_topic;
+        le_size_t    bk_length;
+        char const * bk_table;
+        le_size_t    bk_tlength;
+
+    };
+
 /*
     header - function prototypes
  */
 
-    /*! \brief buffer methods
+    /*! \brief layer methods
+     *
+     *  This function decodes the provided layer description and assigns the
+     *  provided layer structure accordingly. The description has the form :
      *
-     *  This function is used to initialise the content of the provided uv3
-     *  record buffer. It simply sets the position to zeros and assign the
-     *  provided color. In addition, it also sets the primitive type to two
-     *  expecting only lines from INTERLIS format.
+     *      topic,table[,red,green,blue]
      *
-     *  \param dl_buffer uv3 record buffer
-     *  \param dl_red    uv3 record red color
-     *  \param dl_green  uv3 record green color
-     *  \param dl_blue   uv3 record blue color
+     *  The color components default to zero. A non-numerical component or a
+     *  component above 255 is rejected as a format error. The output index
+     *  of the layer is not assigned.
+     *
+     *  \param dl_string Layer description
+     *  \param dl_layer  Layer structure
      */
 
-    void dl_interlis_init( le_byte_t * dl_buffer, le_byte_t const dl_red, le_byte_t const dl_green, le_byte_t const dl_blue );
+    void dl_interlis_layer( char const * const dl_string, dl_layer_t & dl_layer );
 
     /*! \brief buffer methods
      *
-     *  This function is used to assign a planimetric position to the provided
-     *  uv3 record buffer before to export it in the provided stream. The
-     *  provided stream has to be an already open stream in binary mode.
+     *  This function pushes an uv3 line vertex, at the provided planimetric
+     *  position, in the buffer of the provided output. The height is set to
+     *  zero and the provided color is assigned to the record. The buffer is
+     *  flushed in the output stream as it gets full. If the output has no
+     *  buffer, the record is pushed in its spill array.
      *
-     *  \param dl_buffer uv3 record buffer
-     *  \param dl_stream Exportation stream
+     *  \param dl_output Output structure
+     *  \param dl_color  Color of the record
      *  \param dl_x      Planimetric x position
      *  \param dl_y      Planimetric y position
      */
 
-    void dl_interlis_export( le_byte_t * const dl_buffer, std::ofstream & dl_stream, le_real_t const dl_x, le_real_t const dl_y );
+    void dl_interlis_export( dl_output_t & dl_output, le_data_t const * const dl_color, le_real_t const dl_x, le_real_t const dl_y );
+
+    /*! \brief buffer methods
+     *
+     *  This function writes the buffered records of the provided output in its
+     *  stream and resets the buffer.
+     *
+     *  \param dl_output Output structure
+     */
+
+    void dl_interlis_flush( dl_output_t & dl_output );
+
+    /*! \brief parsing methods
+     *
+     *  This function searches the next token starting at the provided position
+     *  and before the provided tail. The tokens are separated by white spaces.
+     *  The position of the found token is returned and its length is set in the
+     *  provided reference. If no token is found, the tail is returned.
+     *
+     *  \param dl_parse  Parsing position
+     *  \param dl_tail   Parsing tail
+     *  \param dl_length Length of the found token
+     *
+     *  \return Returns position of the found token
+     */
+
+    char const * dl_interlis_token( char const * dl_parse, char const * const dl_tail, le_size_t & dl_length );
+
+    /*! \brief parsing methods
+     *
+     *  This function compares the provided token with the provided null
+     *  terminated word.
+     *
+     *  \param dl_token  Token position
+     *  \param dl_length Token length
+     *  \param dl_word   Compared word
+     *
+     *  \return Returns true if the token matches the word, false otherwise
+     */
+
+    bool dl_interlis_match( char const * const dl_token, le_size_t const dl_length, char const * const dl_word );
+
+    /*! \brief parsing methods
+     *
+     *  This function converts the provided token into a floating point value
+     *  using the \b lc_parse_real() function. The token is copied in a local
+     *  null terminated buffer as the mapped data are not.
+     *
+     *  \param dl_token  Token position
+     *  \param dl_length Token length
+     *
+     *  \return Returns the converted value
+     */
+
+    le_real_t dl_interlis_real( char const * const dl_token, le_size_t const dl_length );
+
+    /*! \brief parsing methods
+     *
+     *  This function searches the layers targeting the provided topic and table
+     *  tokens and pushes their index in the provided active layers array, after
+     *  clearing it.
+     *
+     *  \param dl_topic   Topic token position
+     *  \param dl_tlength Topic token length
+     *  \param dl_table   Table token position
+     *  \param dl_length  Table token length
+     *  \param dl_layers  Layers structures
+     *  \param dl_active  Active layers array
+     */
+
+    void dl_interlis_active( char const * const dl_topic, le_size_t const dl_tlength, char const * const dl_table, le_size_t const dl_length, std::vector < dl_layer_t > const & dl_layers, std::vector < le_size_t > & dl_active );
+
+    /*! \brief parsing methods
+     *
+     *  This function parses the provided range of INTERLIS data and extracts
+     *  the geometry of the tables of the provided layers in a single pass. The
+     *  geometry of each layer is converted into uv3 lines, colored with the
+     *  layer color, and exported through the layer output.
+     *
+     *  The tokens are parsed directly in the provided range, without any copy
+     *  or allocation per token.
+     *
+     *  If a context topic token is provided, the range is considered as
+     *  starting inside this topic, which is the case of table blocks. If a
+     *  context table token is also provided, the range is considered as
+     *  starting inside this table, on a STPT line, which is the case of the
+     *  blocks following the split of a large table.
+     *
+     *  \param dl_head     Data range head
+     *  \param dl_tail     Data range tail
+     *  \param dl_context  Context topic token position, null pointer if none
+     *  \param dl_clength  Context topic token length
+     *  \param dl_ctable   Context table token position, null pointer if none
+     *  \param dl_ctlength Context table token length
+     *  \param dl_layers   Layers structures
+     *  \param dl_outputs  Outputs structures
+     */
+
+    void dl_interlis_parse( char const * const dl_head, char const * const dl_tail, char const * const dl_context, le_size_t const dl_clength, char const * const dl_ctable, le_size_t const dl_ctlength, std::vector < dl_layer_t > const & dl_layers, std::vector < dl_output_t > & dl_outputs );
+
+    /*! \brief parsing methods
+     *
+     *  This function scans the lines of the provided range of INTERLIS data to
+     *  locate the table blocks containing the geometry of the provided layers.
+     *  Only the keywords starting the lines are considered : each TABL line of
+     *  a topic starts a block, which ends at the next TABL, TOPI or ETOP line.
+     *
+     *  As the records of a block are held in memory until it is exported, a
+     *  block larger than the split size is closed on its next STPT line, on
+     *  which a new block of the same table starts. This bounds the memory used
+     *  by each block and allows a single large table to be converted by many
+     *  threads.
+     *
+     *  The found blocks are pushed, in the order of the data, in the provided
+     *  array.
+     *
+     *  \param dl_head   Data range head
+     *  \param dl_tail   Data range tail
+     *  \param dl_layers Layers structures
+     *  \param dl_blocks Blocks array
+     */
+
+    void dl_interlis_scan( char const * const dl_head, char const * const dl_tail, std::vector < dl_layer_t > const & dl_layers, std::vector < dl_block_t > & dl_blocks );
 
     /*! \brief main methods
      *
@@ -119,15 +352,32 @@
      *                           --blue/-b [uv3 record color]
      *                           --topic/-t [interlis target topic]
      *                           --table/-a [interlis target table]
+     *                           --layer/-l [interlis target layer, repeatable]
+     *                           --directory/-d [output directory]
+     *                           --threads/-n [amount of threads]
      *
-     *  The main function starts by locating the target topic in the provided
-     *  interlis data file. In the found topic, the target table is searched.
-     *  The content of the table is then read object by object to extract the
-     *  geometry.
+     *  The main function starts by mapping the provided interlis data file in
+     *  memory and by locating the target topic in it. In the found topic, the
+     *  target table is searched. The content of the table is then read object
+     *  by object to extract the geometry.
      *
      *  The geometry is converted into uv3 lines primitive before to be exported
-     *  in the output uv3 file. The provided color is used to assign the uv3
-     *  primitives color.
+     *  in the output uv3 file, through a records buffer. The provided color is
+     *  used to assign the uv3 primitives color.
+     *
+     *  Several layers can be extracted in a single pass by repeating the layer
+     *  argument, each layer providing its topic, table and color. The layers
+     *  are merged in the output file or, if an output directory is provided,
+     *  each layer is exported in its own file named after its topic and table,
+     *  in which case two layers can not share the same topic and table. If no
+     *  layer argument is provided, the topic, table and color arguments
+     *  define the single layer to extract.
+     *
+     *  When more than one thread is used, the data are first scanned to locate
+     *  the table blocks to extract, the large tables being split in several
+     *  blocks. The blocks are then converted concurrently, by groups of the
+     *  amount of threads, their records being exported in the order of the
+     *  data.
      *
      *  \param  argc Standard parameter
      *  \param  argv Standard parameter
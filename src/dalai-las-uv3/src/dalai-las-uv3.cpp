@@ -21,137 +21,600 @@
     # include "dalai-las-uv3.hpp"
 
 /*
-    source - main methods
+    source - constructor/destructor methods
  */
 
-    int main( int argc, char ** argv ) {
+    dl_las_t::dl_las_t( char const * const dl_path )
 
-        /* intensities factor variable */
-        le_real_t dl_factor( lc_read_double( argc, argv, "--factor", "-f", 1.0 ) );
+        : ls_handle( -1 )
+        , ls_data( nullptr )
+        , ls_size( 0 )
+        , ls_format( 0 )
+        , ls_compress( false )
+        , ls_offset( 0 )
+        , ls_length( 0 )
+        , ls_count( 0 )
+        , ls_class( 0 )
+        , ls_cmask( 0 )
+        , ls_color( 0 )
 
-        /* buffer variable */
-        le_byte_t dl_buffer[LE_ARRAY_DATA] = { 0 };
+    {
 
-        /* buffer pointer variable */
-        le_real_t * dl_uv3p( nullptr );
-        le_data_t * dl_uv3d( nullptr );
+        /* stream status variable */
+        struct stat dl_status;
 
-        /* color mapping variable */
-        char dl_colormap[19][3] = DL_COLORMAP;
+        /* check path */
+        if ( dl_path == nullptr ) {
 
-        /* extraction mode variable */
-        le_enum_t dl_extract = DL_EXTRACT_CLASS;
+            /* send message */
+            throw( LC_ERROR_IO_READ );
 
-        /* stream variable */
-        std::ifstream dl_istream;
+        }
 
-        /* stream variable */
-        std::ofstream dl_ostream;
+        /* open stream */
+        if ( ( ls_handle = open( dl_path, O_RDONLY ) ) < 0 ) {
 
-    /* error management */
-     try {
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
+        /* retrieve stream status */
+        if ( fstat( ls_handle, & dl_status ) != 0 ) {
 
-        /* check input stream */
-        if ( dl_istream.is_open() == false ) {
+            /* delete descriptor */
+            close( ls_handle );
 
             /* send message */
             throw( LC_ERROR_IO_READ );
 
         }
 
-        /* create output stream */
-        dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+        /* check stream size */
+        if ( ( ls_size = dl_status.st_size ) < DL_LAS_HEADER ) {
 
-        /* check output stream */
-        if ( dl_ostream.is_open() == false ) {
+            /* delete descriptor */
+            close( ls_handle );
 
             /* send message */
-            throw( LC_ERROR_IO_WRITE );
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* map stream */
+        if ( ( ls_data = ( le_byte_t * ) mmap( nullptr, ls_size, PROT_READ, MAP_PRIVATE, ls_handle, 0 ) ) == MAP_FAILED ) {
+
+            /* delete descriptor */
+            close( ls_handle );
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* advise access pattern */
+        madvise( ls_data, ls_size, MADV_SEQUENTIAL );
+
+        /* header analysis */
+        try {
+
+            /* decode header */
+            dl_las_header();
+
+        } catch ( int dl_code ) {
+
+            /* release mapping */
+            munmap( ls_data, ls_size );
+
+            /* delete descriptor */
+            close( ls_handle );
+
+            /* send message */
+            throw( dl_code );
+
+        }
+
+    }
+
+    dl_las_t::~dl_las_t() {
+
+        /* release mapping */
+        munmap( ls_data, ls_size );
+
+        /* delete descriptor */
+        close( ls_handle );
+
+    }
+
+/*
+    source - accessor methods
+ */
+
+    le_enum_t dl_las_t::dl_las_get_format( le_void_t ) {
+
+        /* return point format */
+        return( ls_format );
+
+    }
+
+    bool dl_las_t::dl_las_get_compress( le_void_t ) {
+
+        /* return compression flag */
+        return( ls_compress );
+
+    }
+
+/*
+    source - header methods
+ */
+
+    le_void_t dl_las_t::dl_las_header( le_void_t ) {
+
+        /* record length variable */
+        static le_size_t const dl_record[DL_LAS_LAST + 1] = DL_LAS_RECORD;
+
+        /* header size variable */
+        uint16_t dl_hsize( 0 );
+
+        /* offset variable */
+        uint32_t dl_offset( 0 );
+
+        /* length variable */
+        uint16_t dl_length( 0 );
+
+        /* count variable */
+        uint32_t dl_count( 0 );
+
+        /* count variable */
+        uint64_t dl_count14( 0 );
+
+        /* check signature */
+        if ( std::memcmp( ls_data, "LASF", 4 ) != 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* check version */
+        if ( ( ls_data[DL_LAS_VERSION] != 1 ) || ( ls_data[DL_LAS_VERSION + 1] > 4 ) ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* retrieve header fields */
+        std::memcpy( & dl_hsize , ls_data + DL_LAS_HSIZE , sizeof( uint16_t ) );
+        std::memcpy( & dl_offset, ls_data + DL_LAS_OFFSET, sizeof( uint32_t ) );
+        std::memcpy( & dl_length, ls_data + DL_LAS_LENGTH, sizeof( uint16_t ) );
+        std::memcpy( & dl_count , ls_data + DL_LAS_COUNT , sizeof( uint32_t ) );
+
+        /* retrieve coordinates transformation */
+        std::memcpy( ls_scale, ls_data + DL_LAS_SCALE, sizeof( le_real_t ) * 3 );
+        std::memcpy( ls_shift, ls_data + DL_LAS_SHIFT, sizeof( le_real_t ) * 3 );
+
+        /* retrieve point format */
+        ls_format = ls_data[DL_LAS_FORMAT] & ( ~ DL_LAS_COMPRESS );
+
+        /* retrieve compression flag */
+        ls_compress = ( ls_data[DL_LAS_FORMAT] & DL_LAS_COMPRESS ) != 0;
+
+        /* check las 1.4 header */
+        if ( ( ls_data[DL_LAS_VERSION + 1] == 4 ) && ( dl_hsize >= DL_LAS_HEADER14 ) && ( ls_size >= DL_LAS_HEADER14 ) ) {
+
+            /* retrieve 64 bits count */
+            std::memcpy( & dl_count14, ls_data + DL_LAS_COUNT14, sizeof( uint64_t ) );
+
+        } else {
+
+            /* assign legacy count */
+            dl_count14 = dl_count;
 
         }
 
-        /* reader variables */
-        liblas::Reader dl_las( dl_istream );
+        /* assign header fields */
+        ls_offset = dl_offset;
+        ls_length = dl_length;
+        ls_count  = dl_count14;
+
+        /* check point format */
+        if ( ls_format > DL_LAS_LAST ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
 
         /* check format consistency */
-        if ( ( dl_las.GetHeader().GetVersionMajor() != 1 ) || ( dl_las.GetHeader().GetVersionMinor() > 4 ) ) {
+        if ( ( ls_compress == false ) && ( ls_length < dl_record[ls_format] ) ) {
 
             /* send message */
             throw( LC_ERROR_FORMAT );
 
         }
 
-        /* check classification switch */
-        if ( lc_read_flag( argc, argv, "--classification", "-c" ) == true ) {
+        /* check stream consistency */
+        if ( ( ls_compress == false ) && ( ( ls_offset > ls_size ) || ( ls_count > ( ls_size - ls_offset ) / ls_length ) ) ) {
 
-            /* assign extraction mode */
-            dl_extract = DL_EXTRACT_CLASS;
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* check legacy formats */
+        if ( ls_format < 6 ) {
+
+            /* assign classification */
+            ls_class = 15, ls_cmask = 0x1f;
 
         } else {
 
-            /* check color switch */
-            if ( lc_read_flag( argc, argv, "--color", "-r" ) == true ) {
+            /* assign classification */
+            ls_class = 16, ls_cmask = 0xff;
 
-                /* extract LAS format */
-                le_enum_t dl_format( dl_las.GetHeader().GetDataFormatId() );
+        }
 
-                /* check consistency */
-                if ( ( dl_format == 2 ) || ( dl_format == 3 ) || ( dl_format == 5 ) ) {
+        /* switch on format */
+        switch ( ls_format ) {
 
-                    /* assign extraction mode */
-                    dl_extract = DL_EXTRACT_COLOR;
+            /* assign color offset */
+            case ( 2 ) : ls_color = 20; break;
+            case ( 3 ) :
+            case ( 5 ) : ls_color = 28; break;
+            case ( 7 ) :
+            case ( 8 ) :
+            case ( 10 ) : ls_color = 30; break;
 
-                } else {
+            /* color not available */
+            default : ls_color = 0; break;
 
-                    /* send message */
-                    throw( LC_ERROR_FORMAT );
+        };
+
+    }
+
+/*
+    source - conversion methods
+ */
+
+    le_size_t dl_las_t::dl_las_decode( le_size_t const dl_head, le_size_t const dl_tail, le_byte_t * const dl_buffer, le_enum_t const dl_extract, le_real_t const dl_factor ) {
+
+        /* color mapping variable */
+        static char const dl_colormap[19][3] = DL_COLORMAP;
+
+        /* raw coordinates variable */
+        int32_t dl_raw[3][DL_BLOCK];
+
+        /* coordinates variable */
+        le_real_t dl_pose[3][DL_BLOCK];
+
+        /* block size variable */
+        le_size_t dl_count( 0 );
+
+        /* exportation variable */
+        le_size_t dl_export( 0 );
+
+        /* record pointer variable */
+        le_byte_t const * dl_record( nullptr );
+
+        /* buffer pointer variable */
+        le_real_t * dl_uv3p( nullptr );
+        le_data_t * dl_uv3d( nullptr );
+
+        /* color variable */
+        uint16_t dl_color[3] = { 0, 0, 0 };
+
+        /* intensity variable */
+        uint16_t dl_inten( 0 );
+
+        /* parsing blocks */
+        for ( le_size_t dl_block( dl_head ); dl_block < dl_tail; dl_block += DL_BLOCK ) {
+
+            /* compute block size */
+            dl_count = std::min( le_size_t( DL_BLOCK ), dl_tail - dl_block );
+
+            /* gather raw coordinates */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+                /* compute record pointer */
+                dl_record = ls_data + ls_offset + ( dl_block + dl_parse ) * ls_length;
+
+                /* retrieve raw coordinates */
+                std::memcpy( dl_raw[0] + dl_parse, dl_record    , sizeof( int32_t ) );
+                std::memcpy( dl_raw[1] + dl_parse, dl_record + 4, sizeof( int32_t ) );
+                std::memcpy( dl_raw[2] + dl_parse, dl_record + 8, sizeof( int32_t ) );
+
+            }
+
+            /* apply coordinates transformation */
+            for ( le_size_t dl_dim( 0 ); dl_dim < 3; dl_dim ++ ) {
+
+                /* parsing coordinates - vectorised */
+                for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+                    /* compute coordinate */
+                    dl_pose[dl_dim][dl_parse] = dl_raw[dl_dim][dl_parse] * ls_scale[dl_dim] + ls_shift[dl_dim];
 
                 }
 
-            } else {
+            }
 
-                /* check intensity switch */
-                if ( lc_read_flag( argc, argv, "--intensity", "-e" ) == true ) {
+            /* scatter records */
+            for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
 
-                    /* assign extraction mode */
-                    dl_extract = DL_EXTRACT_INTEN;
+                /* vertex filtering - avoiding nan */
+                if ( dl_pose[0][dl_parse] != dl_pose[0][dl_parse] ) continue;
+                if ( dl_pose[1][dl_parse] != dl_pose[1][dl_parse] ) continue;
+                if ( dl_pose[2][dl_parse] != dl_pose[2][dl_parse] ) continue;
+
+                /* compute record pointer */
+                dl_record = ls_data + ls_offset + ( dl_block + dl_parse ) * ls_length;
+
+                /* compute buffer pointer */
+                dl_uv3p = ( le_real_t * ) ( dl_buffer + dl_export );
+
+                /* compute buffer pointer */
+                dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
+
+                /* assign point coordinates */
+                dl_uv3p[0] = dl_pose[0][dl_parse];
+                dl_uv3p[1] = dl_pose[1][dl_parse];
+                dl_uv3p[2] = dl_pose[2][dl_parse];
+
+                /* assign primitive type */
+                ( * dl_uv3d ) = LE_UV3_POINT;
+
+                /* check extraction mode */
+                if ( dl_extract == DL_EXTRACT_CLASS ) {
+
+                    /* retrieve point classification */
+                    le_enum_t dl_class( ( dl_record[ls_class] & ls_cmask ) % 19 );
+
+                    /* assign classification colormap */
+                    dl_uv3d[1] = dl_colormap[dl_class][0];
+                    dl_uv3d[2] = dl_colormap[dl_class][1];
+                    dl_uv3d[3] = dl_colormap[dl_class][2];
+
+                } else if ( dl_extract == DL_EXTRACT_COLOR ) {
+
+                    /* retrieve point color */
+                    std::memcpy( dl_color, dl_record + ls_color, sizeof( uint16_t ) * 3 );
+
+                    /* assign point color components */
+                    dl_uv3d[1] = dl_color[0] >> 8;
+                    dl_uv3d[2] = dl_color[1] >> 8;
+                    dl_uv3d[3] = dl_color[2] >> 8;
+
+                } else if ( dl_extract == DL_EXTRACT_INTEN ) {
+
+                    /* retrieve point intensity */
+                    std::memcpy( & dl_inten, dl_record + 12, sizeof( uint16_t ) );
+
+                    /* compute point intensity */
+                    le_size_t dl_value( dl_inten * dl_factor );
+
+                    /* assign point intensity */
+                    dl_uv3d[1] = dl_value;
+                    dl_uv3d[2] = dl_value;
+                    dl_uv3d[3] = dl_value;
 
                 }
 
+                /* validate record */
+                dl_export += LE_ARRAY_DATA;
+
             }
 
         }
 
-        /* compute buffer pointer */
-        dl_uv3p = ( le_real_t * ) ( dl_buffer );
+        /* send exportation size */
+        return( dl_export );
+
+    }
+
+    le_void_t dl_las_t::dl_las_export( char const * const dl_path, le_enum_t const dl_extract, le_real_t const dl_factor, le_size_t const dl_threads ) {
+
+        /* buffer variable */
+        le_byte_t * dl_buffer( nullptr );
+
+        /* batch size variable */
+        std::vector < le_size_t > dl_size( dl_threads, 0 );
+
+        /* batch offset variable */
+        std::vector < le_size_t > dl_base( dl_threads, 0 );
+
+        /* output offset variable */
+        le_size_t dl_offset( 0 );
+
+        /* round size variable */
+        le_size_t dl_round( dl_threads * DL_BATCH );
+
+        /* output descriptor variable */
+        int dl_handle( -1 );
+
+        /* check path */
+        if ( dl_path == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_WRITE );
+
+        }
+
+        /* allocate buffer memory */
+        if ( ( dl_buffer = new ( std::nothrow ) le_byte_t[dl_threads * DL_BATCH * LE_ARRAY_DATA] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* create output descriptor */
+        if ( ( dl_handle = open( dl_path, O_WRONLY | O_CREAT | O_TRUNC, 0666 ) ) < 0 ) {
+
+            /* release buffer memory */
+            delete [] dl_buffer;
+
+            /* send message */
+            throw( LC_ERROR_IO_WRITE );
+
+        }
+
+    /* error management */
+    try {
+
+        /* parsing rounds */
+        for ( le_size_t dl_parse( 0 ); dl_parse < ls_count; dl_parse += dl_round ) {
+
+            /* decoding batches */
+            lc_thread( dl_threads, dl_threads, [&]( le_size_t const dl_batch ) {
 
-        /* compute buffer pointer */
-        dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
+                /* batch head variable */
+                le_size_t dl_head( dl_parse + dl_batch * DL_BATCH );
+
+                /* check batch range */
+                if ( dl_head >= ls_count ) {
+
+                    /* empty batch */
+                    dl_size[dl_batch] = 0;
+
+                } else {
+
+                    /* decode batch */
+                    dl_size[dl_batch] = dl_las_decode( dl_head, std::min( dl_head + DL_BATCH, ls_count ), dl_buffer + dl_batch * DL_BATCH * LE_ARRAY_DATA, dl_extract, dl_factor );
+
+                }
+
+            } );
+
+            /* compute batches offset */
+            for ( le_size_t dl_batch( 0 ); dl_batch < dl_threads; dl_batch ++ ) {
+
+                /* assign batch offset */
+                dl_base[dl_batch] = dl_offset;
+
+                /* update output offset */
+                dl_offset += dl_size[dl_batch];
+
+            }
 
-        /* assign primitive type */
-        ( * dl_uv3d ) = LE_UV3_POINT;
+            /* writing batches */
+            lc_thread( dl_threads, dl_threads, [&]( le_size_t const dl_batch ) {
+
+                /* batch pointer variable */
+                le_byte_t * dl_data( dl_buffer + dl_batch * DL_BATCH * LE_ARRAY_DATA );
+
+                /* writing variable */
+                le_size_t dl_write( 0 );
+
+                /* writing variable */
+                ssize_t dl_count( 0 );
+
+                /* writing batch */
+                while ( dl_write < dl_size[dl_batch] ) {
+
+                    /* write batch part */
+                    if ( ( dl_count = pwrite( dl_handle, dl_data + dl_write, dl_size[dl_batch] - dl_write, dl_base[dl_batch] + dl_write ) ) <= 0 ) {
+
+                        /* check interruption */
+                        if ( ( dl_count < 0 ) && ( errno == EINTR ) ) continue;
+
+                        /* send message */
+                        throw( LC_ERROR_IO_WRITE );
+
+                    }
+
+                    /* update writing */
+                    dl_write += dl_count;
+
+                }
+
+            } );
+
+        }
+
+    /* error management */
+    } catch ( int dl_code ) {
+
+        /* delete output descriptor */
+        close( dl_handle );
+
+        /* release buffer memory */
+        delete [] dl_buffer;
+
+        /* send message */
+        throw( dl_code );
+
+    }
+
+        /* delete output descriptor */
+        if ( close( dl_handle ) != 0 ) {
+
+            /* release buffer memory */
+            delete [] dl_buffer;
+
+            /* send message */
+            throw( LC_ERROR_IO_WRITE );
+
+        }
+
+        /* release buffer memory */
+        delete [] dl_buffer;
+
+    }
+
+    le_size_t dl_las_batch( liblas::Reader & dl_las, le_byte_t * const dl_buffer, le_enum_t const dl_extract, le_real_t const dl_factor, bool & dl_last ) {
+
+        /* color mapping variable */
+        static char const dl_colormap[19][3] = DL_COLORMAP;
+
+        /* exportation variable */
+        le_size_t dl_export( 0 );
+
+        /* buffer pointer variable */
+        le_real_t * dl_uv3p( nullptr );
+        le_data_t * dl_uv3d( nullptr );
 
         /* parsing input stream */
-        while ( dl_las.ReadNextPoint() == true ) {
+        for ( le_size_t dl_parse( 0 ); dl_parse < DL_BATCH; dl_parse ++ ) {
+
+            /* read point */
+            if ( dl_las.ReadNextPoint() == false ) {
+
+                /* update flag */
+                dl_last = true;
+
+                /* send exportation size */
+                return( dl_export );
+
+            }
+
+            /* point variable */
+            liblas::Point const & dl_point( dl_las.GetPoint() );
+
+            /* compute buffer pointer */
+            dl_uv3p = ( le_real_t * ) ( dl_buffer + dl_export );
+
+            /* compute buffer pointer */
+            dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
 
             /* retrieve point coordinates */
-            dl_uv3p[0] = dl_las.GetPoint().GetX();
-            dl_uv3p[1] = dl_las.GetPoint().GetY();
-            dl_uv3p[2] = dl_las.GetPoint().GetZ();
+            dl_uv3p[0] = dl_point.GetX();
+            dl_uv3p[1] = dl_point.GetY();
+            dl_uv3p[2] = dl_point.GetZ();
 
             /* vertex filtering - avoiding nan */
             if ( dl_uv3p[0] != dl_uv3p[0] ) continue;
             if ( dl_uv3p[1] != dl_uv3p[1] ) continue;
             if ( dl_uv3p[2] != dl_uv3p[2] ) continue;
 
+            /* assign primitive type */
+            ( * dl_uv3d ) = LE_UV3_POINT;
+
             /* check extraction mode */
             if ( dl_extract == DL_EXTRACT_CLASS ) {
 
                 /* retrieve point classification */
-                le_enum_t dl_class( dl_las.GetPoint().GetClassification().GetClass() % 19 );
+                le_enum_t dl_class( dl_point.GetClassification().GetClass() % 19 );
 
                 /* assign classification colormap */
                 dl_uv3d[1] = dl_colormap[dl_class][0];
@@ -160,15 +623,18 @@
 
             } else if ( dl_extract == DL_EXTRACT_COLOR ) {
 
+                /* color variable */
+                liblas::Color const & dl_color( dl_point.GetColor() );
+
                 /* assign point color components */
-                dl_uv3d[1] = dl_las.GetPoint().GetColor().GetRed()   >> 8;
-                dl_uv3d[2] = dl_las.GetPoint().GetColor().GetGreen() >> 8;
-                dl_uv3d[3] = dl_las.GetPoint().GetColor().GetBlue()  >> 8;
+                dl_uv3d[1] = dl_color.GetRed()   >> 8;
+                dl_uv3d[2] = dl_color.GetGreen() >> 8;
+                dl_uv3d[3] = dl_color.GetBlue()  >> 8;
 
             } else if ( dl_extract == DL_EXTRACT_INTEN ) {
 
                 /* retrieve point intensity */
-                le_size_t dl_inten( dl_las.GetPoint().GetIntensity() * dl_factor );
+                le_size_t dl_inten( dl_point.GetIntensity() * dl_factor );
 
                 /* assign point intensity */
                 dl_uv3d[1] = dl_inten;
@@ -177,16 +643,304 @@
 
             }
 
-            /* output stream exportation */
-            dl_ostream.write( ( char * ) dl_buffer, LE_ARRAY_DATA );
+            /* validate record */
+            dl_export += LE_ARRAY_DATA;
+
+        }
+
+        /* send exportation size */
+        return( dl_export );
+
+    }
+
+    le_void_t dl_las_convert( liblas::Reader & dl_las, std::ofstream & dl_ostream, le_enum_t const dl_extract, le_real_t const dl_factor ) {
+
+        /* buffer variable */
+        le_byte_t * dl_buffer[2] = { nullptr, nullptr };
+
+        /* buffer size variable */
+        le_size_t dl_size[2] = { 0, 0 };
+
+        /* buffer state variable */
+        bool dl_full[2] = { false, false };
+
+        /* buffer state variable */
+        bool dl_last[2] = { false, false };
+
+        /* reading error variable */
+        bool dl_error( false );
+
+        /* buffer index variable */
+        le_size_t dl_index( 0 );
+
+        /* synchronisation variable */
+        std::mutex dl_mutex;
+
+        /* synchronisation variable */
+        std::condition_variable dl_signal;
+
+        /* allocate buffer memory */
+        if ( ( dl_buffer[0] = new ( std::nothrow ) le_byte_t[DL_BATCH * LE_ARRAY_DATA] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* allocate buffer memory */
+        if ( ( dl_buffer[1] = new ( std::nothrow ) le_byte_t[DL_BATCH * LE_ARRAY_DATA] ) == nullptr ) {
+
+            /* release buffer memory */
+            delete [] dl_buffer[0];
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
 
         }
 
-        /* delete output stream */
-        dl_ostream.close();
+        /* create reading thread */
+        std::thread dl_reader( [&]() {
+
+            /* buffer index variable */
+            le_size_t dl_slot( 0 );
+
+            /* reading flag variable */
+            bool dl_flag( false );
+
+            /* reading batches */
+            while ( dl_flag == false ) {
+
+                /* critical section */
+                {
+
+                    /* lock variable */
+                    std::unique_lock < std::mutex > dl_lock( dl_mutex );
+
+                    /* wait buffer release */
+                    dl_signal.wait( dl_lock, [&]() { return( dl_full[dl_slot] == false ); } );
+
+                }
+
+                /* reading batch */
+                try {
+
+                    /* convert batch */
+                    dl_size[dl_slot] = dl_las_batch( dl_las, dl_buffer[dl_slot], dl_extract, dl_factor, dl_flag );
+
+                } catch ( ... ) {
+
+                    /* update error */
+                    dl_error = true;
+
+                    /* update flag */
+                    dl_flag = true;
+
+                    /* discard batch */
+                    dl_size[dl_slot] = 0;
+
+                }
+
+                /* critical section */
+                {
+
+                    /* lock variable */
+                    std::lock_guard < std::mutex > dl_lock( dl_mutex );
+
+                    /* update buffer state */
+                    dl_last[dl_slot] = dl_flag;
+
+                    /* update buffer state */
+                    dl_full[dl_slot] = true;
+
+                }
+
+                /* signal buffer */
+                dl_signal.notify_all();
+
+                /* update buffer index */
+                dl_slot = 1 - dl_slot;
+
+            }
+
+        } );
+
+        /* exporting batches */
+        while ( true ) {
+
+            /* critical section */
+            {
+
+                /* lock variable */
+                std::unique_lock < std::mutex > dl_lock( dl_mutex );
+
+                /* wait buffer filling */
+                dl_signal.wait( dl_lock, [&]() { return( dl_full[dl_index] == true ); } );
+
+            }
 
-        /* delete input stream */
-        dl_istream.close();
+            /* export batch to stream */
+            dl_ostream.write( ( char * ) dl_buffer[dl_index], dl_size[dl_index] );
+
+            /* check last batch */
+            if ( dl_last[dl_index] == true ) break;
+
+            /* critical section */
+            {
+
+                /* lock variable */
+                std::lock_guard < std::mutex > dl_lock( dl_mutex );
+
+                /* update buffer state */
+                dl_full[dl_index] = false;
+
+            }
+
+            /* signal buffer */
+            dl_signal.notify_all();
+
+            /* update buffer index */
+            dl_index = 1 - dl_index;
+
+        }
+
+        /* join reading thread */
+        dl_reader.join();
+
+        /* release buffer memory */
+        delete [] dl_buffer[1];
+
+        /* release buffer memory */
+        delete [] dl_buffer[0];
+
+        /* check reading */
+        if ( dl_error == true ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+    }
+
+/*
+    source - main methods
+ */
+
+    int main( int argc, char ** argv ) {
+
+        /* intensities factor variable */
+        le_real_t dl_factor( lc_read_double( argc, argv, "--factor", "-f", 1.0 ) );
+
+        /* threads variable */
+        le_size_t dl_threads( lc_thread_count( lc_read_unsigned( argc, argv, "--threads", "-n", 0 ) ) );
+
+        /* extraction mode variable */
+        le_enum_t dl_extract = DL_EXTRACT_CLASS;
+
+        /* stream variable */
+        std::ifstream dl_istream;
+
+        /* stream variable */
+        std::ofstream dl_ostream;
+
+    /* error management */
+     try {
+
+        /* create las reader */
+        dl_las_t dl_las( lc_read_string( argc, argv, "--input", "-i" ) );
+
+        /* check classification switch */
+        if ( lc_read_flag( argc, argv, "--classification", "-c" ) == true ) {
+
+            /* assign extraction mode */
+            dl_extract = DL_EXTRACT_CLASS;
+
+        } else {
+
+            /* check color switch */
+            if ( lc_read_flag( argc, argv, "--color", "-r" ) == true ) {
+
+                /* extract LAS format */
+                le_enum_t dl_format( dl_las.dl_las_get_format() );
+
+                /* check consistency */
+                if ( ( dl_format == 2 ) || ( dl_format == 3 ) || ( dl_format == 5 ) || ( dl_format == 7 ) || ( dl_format == 8 ) || ( dl_format == 10 ) ) {
+
+                    /* assign extraction mode */
+                    dl_extract = DL_EXTRACT_COLOR;
+
+                } else {
+
+                    /* send message */
+                    throw( LC_ERROR_FORMAT );
+
+                }
+
+            } else {
+
+                /* check intensity switch */
+                if ( lc_read_flag( argc, argv, "--intensity", "-e" ) == true ) {
+
+                    /* assign extraction mode */
+                    dl_extract = DL_EXTRACT_INTEN;
+
+                }
+
+            }
+
+        }
+
+        /* check compression */
+        if ( dl_las.dl_las_get_compress() == true ) {
+
+            /* create input stream */
+            dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
+
+            /* check input stream */
+            if ( dl_istream.is_open() == false ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_READ );
+
+            }
+
+            /* create output stream */
+            dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+
+            /* check output stream */
+            if ( dl_ostream.is_open() == false ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+            /* reader variables */
+            liblas::Reader dl_reader( dl_istream );
+
+            /* check format consistency */
+            if ( ( dl_reader.GetHeader().GetVersionMajor() != 1 ) || ( dl_reader.GetHeader().GetVersionMinor() > 4 ) ) {
+
+                /* send message */
+                throw( LC_ERROR_FORMAT );
+
+            }
+
+            /* las conversion */
+            dl_las_convert( dl_reader, dl_ostream, dl_extract, dl_factor );
+
+            /* delete output stream */
+            dl_ostream.close();
+
+            /* delete input stream */
+            dl_istream.close();
+
+        } else {
+
+            /* las conversion */
+            dl_las.dl_las_export( lc_read_string( argc, argv, "--output", "-o" ), dl_extract, dl_factor, dl_threads );
+
+        }
 
     /* error management */
     } catch ( int dl_code ) {
@@ -52,6 +52,18 @@
 
     # include <iostream>
     # include <fstream>
+    # include <algorithm>
+    # include <cstring>
+    # include <cstdint>
+    # include <cerrno>
+    # include <vector>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include <sys/mman.h>
+    # include <thread>
+    # include <mutex>
+    # include <condition_variable>
     # include <liblas/liblas.hpp>
     # include <common-include.hpp>
     # include <eratosthene-include.h>
@@ -65,6 +77,36 @@
     # define DL_EXTRACT_COLOR 1
     # define DL_EXTRACT_INTEN 2
 
+    /* define conversion batch - points */
+    # define DL_BATCH ( 262144 )
+
+    /* define decoding block - points */
+    # define DL_BLOCK ( 256 )
+
+    /* define las header */
+    # define DL_LAS_HEADER    ( 227 )
+    # define DL_LAS_HEADER14  ( 375 )
+
+    /* define las header fields offset */
+    # define DL_LAS_VERSION   ( 24 )
+    # define DL_LAS_HSIZE     ( 94 )
+    # define DL_LAS_OFFSET    ( 96 )
+    # define DL_LAS_FORMAT    ( 104 )
+    # define DL_LAS_LENGTH    ( 105 )
+    # define DL_LAS_COUNT     ( 107 )
+    # define DL_LAS_SCALE     ( 131 )
+    # define DL_LAS_SHIFT     ( 155 )
+    # define DL_LAS_COUNT14   ( 247 )
+
+    /* define las point format - compression bits */
+    # define DL_LAS_COMPRESS  ( 0xc0 )
+
+    /* define las point format - last format */
+    # define DL_LAS_LAST      ( 10 )
+
+    /* define las point record length - per format */
+    # define DL_LAS_RECORD    { 20, 28, 26, 34, 57, 63, 30, 36, 38, 59, 67 }
+
     /* define classification colormap */
     # define DL_COLORMAP { \
     {  64,  64,  64 }, \
@@ -100,10 +142,213 @@
     header - structures
  */
 
+    /*! \class dl_las_t
+     *  \brief LAS reader class
+     *
+     *  This class maps a las file in memory and decodes its header. It then
+     *  allows to decode ranges of point records directly into uv3 records,
+     *  without any library call per point. All point formats from 0 to 10, as
+     *  defined from las 1.0 to las 1.4, are supported.
+     *
+     *  Compressed las files are detected but not decoded by this class, their
+     *  conversion being left to liblas.
+     *
+     *  \var dl_las_t::ls_handle
+     *  File descriptor of the las file
+     *  \var dl_las_t::ls_data
+     *  Mapping of the las file
+     *  \var dl_las_t::ls_size
+     *  Size, in bytes, of the las file
+     *  \var dl_las_t::ls_format
+     *  Point format, compression bits removed
+     *  \var dl_las_t::ls_compress
+     *  Compression flag of the point records
+     *  \var dl_las_t::ls_offset
+     *  Offset, in bytes, of the first point record
+     *  \var dl_las_t::ls_length
+     *  Length, in bytes, of a point record
+     *  \var dl_las_t::ls_count
+     *  Amount of point records
+     *  \var dl_las_t::ls_scale
+     *  Scale factors of the coordinates
+     *  \var dl_las_t::ls_shift
+     *  Offsets of the coordinates
+     *  \var dl_las_t::ls_class
+     *  Offset in record, in bytes, of the classification
+     *  \var dl_las_t::ls_cmask
+     *  Mask of the classification bits
+     *  \var dl_las_t::ls_color
+     *  Offset in record, in bytes, of the color, zero if not available
+     */
+
+    class dl_las_t {
+
+        private:
+
+            int         ls_handle;
+            le_byte_t * ls_data;
+            le_size_t   ls_size;
+
+            le_enum_t ls_format;
+            bool      ls_compress;
+            le_size_t ls_offset;
+            le_size_t ls_length;
+            le_size_t ls_count;
+
+            le_real_t ls_scale[3];
+            le_real_t ls_shift[3];
+
+            le_size_t ls_class;
+            le_byte_t ls_cmask;
+            le_size_t ls_color;
+
+        public:
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The constructor opens and maps the provided las file before to
+         *  decode its header using the \b dl_las_header() method.
+         *
+         *  \param dl_path Path to the las file
+         */
+
+        dl_las_t( char const * const dl_path );
+
+        /*! \brief constructor/destructor methods
+         *
+         *  The destructor releases the mapping of the las file and deletes its
+         *  descriptor.
+         */
+
+        ~dl_las_t();
+
+        /*! \brief accessor methods
+         *
+         *  This function returns the point format of the las file.
+         *
+         *  \return Returns point format
+         */
+
+        le_enum_t dl_las_get_format( le_void_t );
+
+        /*! \brief accessor methods
+         *
+         *  This function returns true if the point records are compressed.
+         *
+         *  \return Returns compression flag
+         */
+
+        bool dl_las_get_compress( le_void_t );
+
+        private:
+
+        /*! \brief header methods
+         *
+         *  This function decodes and checks the las header. The las version has
+         *  to be in the range 1.0 to 1.4 and the point format from 0 to 10. For
+         *  las 1.4, the 64 bits amount of point records is considered.
+         *
+         *  The offsets of the classification and color in the records are set
+         *  according to the point format. For uncompressed files, the point
+         *  records have to fit in the file.
+         */
+
+        le_void_t dl_las_header( le_void_t );
+
+        public:
+
+        /*! \brief conversion methods
+         *
+         *  This function decodes the point records in the provided range into
+         *  uv3 point records written in the provided buffer. The colors of the
+         *  records are assigned according to the extraction mode. The points
+         *  with non-numerical coordinates are discarded.
+         *
+         *  The records are decoded by blocks of DL_BLOCK points : the raw
+         *  coordinates are first gathered in arrays, allowing the scale and
+         *  offset to be applied in vectorisable loops, before to be written,
+         *  with the colors, in the uv3 records.
+         *
+         *  \param dl_head    Index of the first point record
+         *  \param dl_tail    Index following the last point record
+         *  \param dl_buffer  Buffer receiving the uv3 records
+         *  \param dl_extract Extraction mode
+         *  \param dl_factor  Intensities factor
+         *
+         *  \return Returns the size, in bytes, of the decoded records
+         */
+
+        le_size_t dl_las_decode( le_size_t const dl_head, le_size_t const dl_tail, le_byte_t * const dl_buffer, le_enum_t const dl_extract, le_real_t const dl_factor );
+
+        /*! \brief conversion methods
+         *
+         *  This function converts the point records of the las file and exports
+         *  the obtained uv3 records in the provided output file. The records
+         *  are decoded by batches of DL_BATCH points using the
+         *  \b dl_las_decode() method.
+         *
+         *  The batches are processed by rounds, each thread of the provided
+         *  amount decoding one batch of the round in its own buffer. The sizes
+         *  of the decoded batches are then accumulated to give the offset of
+         *  each batch in the output file, in which they are written concurrently
+         *  using positioned writes. The order of the records is then the same
+         *  as for a sequential conversion.
+         *
+         *  \param dl_path    Path of the output file
+         *  \param dl_extract Extraction mode
+         *  \param dl_factor  Intensities factor
+         *  \param dl_threads Amount of threads
+         */
+
+        le_void_t dl_las_export( char const * const dl_path, le_enum_t const dl_extract, le_real_t const dl_factor, le_size_t const dl_threads );
+
+    };
+
 /*
     header - function prototypes
  */
 
+    /*! \brief conversion methods
+     *
+     *  This function reads, using the provided las reader, at most DL_BATCH
+     *  points and converts them into uv3 point records written in the provided
+     *  buffer. The colors of the records are assigned according to the
+     *  extraction mode. The points with non-numerical coordinates are
+     *  discarded.
+     *
+     *  The reader point is retrieved only once per point. If the end of the
+     *  las stream is reached, the provided flag is set to true.
+     *
+     *  \param dl_las     Las reader
+     *  \param dl_buffer  Batch buffer receiving the uv3 records
+     *  \param dl_extract Extraction mode
+     *  \param dl_factor  Intensities factor
+     *  \param dl_last    Flag set when the end of the stream is reached
+     *
+     *  \return Returns the size, in bytes, of the converted records
+     */
+
+    le_size_t dl_las_batch( liblas::Reader & dl_las, le_byte_t * const dl_buffer, le_enum_t const dl_extract, le_real_t const dl_factor, bool & dl_last );
+
+    /*! \brief conversion methods
+     *
+     *  This function converts the content of the provided las reader and
+     *  exports the obtained uv3 records in the provided output stream.
+     *
+     *  The conversion is made by batches through two buffers. A reading thread
+     *  fills, using the \b dl_las_batch() function, the buffer not being
+     *  written while the calling thread exports the other one, overlapping
+     *  the las decoding with the uv3 exportation. The order of the records is
+     *  preserved.
+     *
+     *  \param dl_las     Las reader
+     *  \param dl_ostream Output stream
+     *  \param dl_extract Extraction mode
+     *  \param dl_factor  Intensities factor
+     */
+
+    le_void_t dl_las_convert( liblas::Reader & dl_las, std::ofstream & dl_ostream, le_enum_t const dl_extract, le_real_t const dl_factor );
+
     /*! \brief main function
      *
      *  The main function converts the provided las (asprs) file and converts
@@ -114,11 +359,17 @@
      *                      --classification/-c [extraction switch]
      *                      --color/-r [extraction switch]
      *                      --intensity/-e [extraction switch]
+     *                      --factor/-f [intensities factor]
+     *                      --threads/-n [amount of threads]
      *
-     *  The main function starts by reading the input file header. Depending on
-     *  the provided extraction switch, the availability of the desired data
-     *  components is checked. The file content is read and converted into the
-     *  uv3 format before to be written in the output stream.
+     *  The main function starts by mapping the input file and decoding its
+     *  header. Depending on the provided extraction switch, the availability
+     *  of the desired data components is checked. The point records are then
+     *  decoded directly from the mapping and converted into the uv3 format, by
+     *  batches, before to be written in the output stream. The batches are
+     *  converted by the provided amount of threads, all the host threads being
+     *  used by default. Compressed files are read and converted through liblas
+     *  by a single reading thread.
      *
      *  If no extraction switch is provided, the classification is assumed for
      *  extraction. If multiple extraction switch are provided, only the first
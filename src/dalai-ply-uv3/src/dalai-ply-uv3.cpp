@@ -25,12 +25,25 @@
     source - constructor/destructor methods
  */
 
-    dl_ply_t::dl_ply_t( le_char_t const * const dl_path )
+    dl_ply_t::dl_ply_t( le_char_t const * const dl_path, le_size_t const dl_memory )
 
-        : py_vcount( 0 )
+        : py_handle( -1 )
+        , py_vcount( 0 )
         , py_fcount( 0 )
+        , py_format( DL_FORMAT_BINLE )
         , py_offset( 0 )
         , py_vsize( 0 )
+        , py_buffer( nullptr )
+        , py_bhead( 0 )
+        , py_btail( 0 )
+        , py_memory( dl_memory )
+        , py_cache( nullptr )
+        , py_craw( nullptr )
+        , py_cframe( 0 )
+        , py_chand( 0 )
+        , py_chits( 0 )
+        , py_cmiss( 0 )
+        , py_decode( DL_DECODE_GENERIC )
 
     {
 
@@ -65,6 +78,14 @@
 
         }
 
+        /* create cache descriptor */
+        if ( ( py_handle = open( ( char * ) dl_path, O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
         /* ply-header analysis */
         dl_ply_header();
 
@@ -72,9 +93,52 @@
 
     dl_ply_t::~dl_ply_t() {
 
+        /* check buffer */
+        if ( py_buffer != nullptr ) {
+
+            /* release buffer memory */
+            delete [] py_buffer;
+
+        }
+
+        /* check cache */
+        if ( py_cache != nullptr ) {
+
+            /* release cache memory */
+            delete [] py_cache;
+
+        }
+
+        /* check cache */
+        if ( py_craw != nullptr ) {
+
+            /* release cache memory */
+            delete [] py_craw;
+
+        }
+
         /* delete stream */
         py_stream.close();
 
+        /* check cache descriptor */
+        if ( py_handle >= 0 ) {
+
+            /* delete cache descriptor */
+            close( py_handle );
+
+        }
+
+        /* check transcoded stream */
+        if ( py_spill.empty() == false ) {
+
+            /* remove transcoded stream */
+            std::remove( py_spill.c_str() );
+
+            /* delete temporary storage */
+            lc_temp_directory( nullptr, ( char * ) py_path, LC_TEMP_DELETE );
+
+        }
+
     }
 
 /*
@@ -241,8 +305,23 @@
 
                 case ( DL_MODE_FORMAT ) : {
 
-                    /* check format */
-                    if ( dl_word != "binary_little_endian" ) {
+                    /* switch on token - format */
+                    if ( dl_word == "binary_little_endian" ) {
+
+                        /* assign format */
+                        py_format = DL_FORMAT_BINLE;
+
+                    } else if ( dl_word == "binary_big_endian" ) {
+
+                        /* assign format */
+                        py_format = DL_FORMAT_BINBE;
+
+                    } else if ( dl_word == "ascii" ) {
+
+                        /* assign format */
+                        py_format = DL_FORMAT_ASCII;
+
+                    } else {
 
                         /* send message */
                         throw( LC_ERROR_FORMAT );
@@ -354,6 +433,9 @@
 
         }
 
+        /* select decoding kernel */
+        dl_ply_header_decode();
+
     }
 
     le_void_t dl_ply_t::dl_ply_header_vertex( le_enum_t const dl_type, std::string & dl_word ) {
@@ -412,6 +494,9 @@
         /* update record size */
         py_vsize += dl_ply_type_length( dl_type );
 
+        /* push property type */
+        py_vlist.push_back( dl_type );
+
     }
 
     le_void_t dl_ply_t::dl_ply_header_face( le_enum_t const dl_list, le_enum_t const dl_type ) {
@@ -430,6 +515,39 @@
 
     }
 
+    le_void_t dl_ply_t::dl_ply_header_decode() {
+
+        /* check color layout */
+        if ( ( py_vtype[DL_VERTEX_R] != DL_TYPE_UCHAR ) || ( py_vtype[DL_VERTEX_G] != DL_TYPE_UCHAR ) || ( py_vtype[DL_VERTEX_B] != DL_TYPE_UCHAR ) ) {
+
+            /* generic kernel */
+            py_decode = DL_DECODE_GENERIC;
+
+        /* check position layout */
+        } else if ( ( py_vtype[DL_VERTEX_Y] != py_vtype[DL_VERTEX_X] ) || ( py_vtype[DL_VERTEX_Z] != py_vtype[DL_VERTEX_X] ) ) {
+
+            /* generic kernel */
+            py_decode = DL_DECODE_GENERIC;
+
+        } else if ( py_vtype[DL_VERTEX_X] == DL_TYPE_FLOAT ) {
+
+            /* specialised kernel */
+            py_decode = DL_DECODE_FLOAT;
+
+        } else if ( py_vtype[DL_VERTEX_X] == DL_TYPE_DOUBLE ) {
+
+            /* specialised kernel */
+            py_decode = DL_DECODE_DOUBLE;
+
+        } else {
+
+            /* generic kernel */
+            py_decode = DL_DECODE_GENERIC;
+
+        }
+
+    }
+
 /*
     source - i/o methods
  */
@@ -445,7 +563,7 @@
                 int8_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( int8_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( int8_t ) );
 
                 /* return read value */
                 return( dl_read );
@@ -458,7 +576,7 @@
                 uint8_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( uint8_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( uint8_t ) );
 
                 /* return read value */
                 return( dl_read );
@@ -471,7 +589,10 @@
                 int16_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( int16_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( int16_t ) );
+
+                /* check byte order */
+                if ( py_format == DL_FORMAT_BINBE ) dl_read = __builtin_bswap16( dl_read );
 
                 /* return read value */
                 return( dl_read );
@@ -484,7 +605,10 @@
                 uint16_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( uint16_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( uint16_t ) );
+
+                /* check byte order */
+                if ( py_format == DL_FORMAT_BINBE ) dl_read = __builtin_bswap16( dl_read );
 
                 /* return read value */
                 return( dl_read );
@@ -497,7 +621,10 @@
                 int32_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( int32_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( int32_t ) );
+
+                /* check byte order */
+                if ( py_format == DL_FORMAT_BINBE ) dl_read = __builtin_bswap32( dl_read );
 
                 /* return read value */
                 return( dl_read );
@@ -510,7 +637,10 @@
                 uint32_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( uint32_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( uint32_t ) );
+
+                /* check byte order */
+                if ( py_format == DL_FORMAT_BINBE ) dl_read = __builtin_bswap32( dl_read );
 
                 /* return read value */
                 return( dl_read );
@@ -523,7 +653,10 @@
                 int64_t dl_read( 0 );
 
                 /* read variable */
-                py_stream.read( ( char * ) ( & dl_read ), sizeof( int64_t ) );
+                dl_ply_io_read( ( le_byte_t * ) ( & dl_read ), sizeof( int64_t ) );
+
+                /* check byte order */
+                if ( py_format == DL_FORMAT_BINBE ) dl_read = __builtin_bswap64( dl_read );
 
                 /* return read value */
                 return( dl_read );
@@ -538,19 +671,563 @@
 
     }
 
-    le_void_t dl_ply_t::dl_ply_io_vertex( le_size_t const dl_index, le_byte_t * const dl_buffer ) {
+    le_void_t dl_ply_t::dl_ply_io_swap( le_byte_t * const dl_data, le_size_t const dl_length ) {
 
-        /* offset variable */
-        le_size_t dl_offset( py_stream.tellg() );
+        /* swapping variable */
+        uint16_t dl_swap16( 0 );
 
-        /* update offset */
-        py_stream.seekg( py_offset + dl_index * py_vsize, std::ios::beg );
+        /* swapping variable */
+        uint32_t dl_swap32( 0 );
+
+        /* swapping variable */
+        uint64_t dl_swap64( 0 );
+
+        /* switch on length */
+        switch ( dl_length ) {
+
+            case ( 2 ) : {
+
+                /* read value */
+                std::memcpy( & dl_swap16, dl_data, 2 );
+
+                /* swap value */
+                dl_swap16 = __builtin_bswap16( dl_swap16 );
+
+                /* write value */
+                std::memcpy( dl_data, & dl_swap16, 2 );
+
+            } break;
+
+            case ( 4 ) : {
+
+                /* read value */
+                std::memcpy( & dl_swap32, dl_data, 4 );
+
+                /* swap value */
+                dl_swap32 = __builtin_bswap32( dl_swap32 );
+
+                /* write value */
+                std::memcpy( dl_data, & dl_swap32, 4 );
+
+            } break;
+
+            case ( 8 ) : {
+
+                /* read value */
+                std::memcpy( & dl_swap64, dl_data, 8 );
+
+                /* swap value */
+                dl_swap64 = __builtin_bswap64( dl_swap64 );
+
+                /* write value */
+                std::memcpy( dl_data, & dl_swap64, 8 );
+
+            } break;
+
+        };
+
+    }
+
+    le_void_t dl_ply_t::dl_ply_io_read( le_byte_t * const dl_data, le_size_t const dl_size ) {
+
+        /* parsing bytes */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_size; dl_parse ++ ) {
+
+            /* check buffer state */
+            if ( py_bhead == py_btail ) {
+
+                /* read buffer */
+                py_stream.read( ( char * ) py_buffer, DL_PLY_BUFFER );
+
+                /* check buffer */
+                if ( ( py_btail = py_stream.gcount() ) == 0 ) {
+
+                    /* send message */
+                    throw( LC_ERROR_IO_READ );
+
+                }
+
+                /* reset buffer head */
+                py_bhead = 0;
+
+            }
+
+            /* assign byte */
+            dl_data[dl_parse] = py_buffer[py_bhead ++];
+
+        }
+
+    }
+
+/*
+    source - ascii methods
+ */
+
+    le_void_t dl_ply_t::dl_ply_ascii( char const * const dl_root ) {
+
+        /* stream variable */
+        std::fstream dl_stream;
+
+        /* buffer variable */
+        le_byte_t * dl_obuffer( nullptr );
+
+        /* exportation variable */
+        le_size_t dl_export( 0 );
+
+        /* vertex count variable */
+        le_real_t dl_vcount( 0.0 );
+
+        /* allocate buffer memory */
+        if ( ( py_buffer = new ( std::nothrow ) le_byte_t[DL_PLY_BUFFER + 1] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* allocate buffer memory */
+        if ( ( dl_obuffer = new ( std::nothrow ) le_byte_t[DL_PLY_BUFFER] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* create temporary storage */
+        lc_temp_directory( dl_root, ( char * ) py_path, LC_TEMP_CREATE );
+
+        /* compose transcoded stream path */
+        py_spill = std::string( ( char * ) py_path ) + "/binary";
+
+        /* create transcoded stream */
+        dl_stream.open( py_spill, std::ios::out | std::ios::trunc | std::ios::binary );
+
+        /* check transcoded stream */
+        if ( dl_stream.is_open() == false ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_ACCESS );
+
+        }
+
+        /* clear stream */
+        py_stream.clear();
+
+        /* offset position */
+        py_stream.seekg( py_offset, std::ios::beg );
+
+        /* transcoding vertex */
+        for ( le_size_t dl_vertex( 0 ); dl_vertex < py_vcount; dl_vertex ++ ) {
+
+            /* check buffer state */
+            if ( ( dl_export + py_vsize ) > DL_PLY_BUFFER ) {
+
+                /* export chunk to stream */
+                dl_stream.write( ( char * ) dl_obuffer, dl_export );
+
+                /* reset exportation offset */
+                dl_export = 0;
+
+            }
+
+            /* transcoding vertex property */
+            for ( le_size_t dl_parse( 0 ); dl_parse < py_vlist.size(); dl_parse ++ ) {
+
+                /* encode property value */
+                dl_export += dl_ply_ascii_encode( dl_obuffer + dl_export, py_vlist[dl_parse], dl_ply_ascii_read() );
+
+            }
+
+        }
+
+        /* transcoding faces */
+        for ( le_size_t dl_face( 0 ); dl_face < py_fcount; dl_face ++ ) {
+
+            /* read face vertex count */
+            dl_vcount = dl_ply_ascii_read();
+
+            /* check consistency */
+            if ( ( dl_vcount < 0.0 ) || ( ( dl_vcount + 1.0 ) * sizeof( int64_t ) > DL_PLY_BUFFER ) ) {
+
+                /* send message */
+                throw( LC_ERROR_FORMAT );
+
+            }
+
+            /* check buffer state */
+            if ( ( dl_export + ( le_size_t( dl_vcount ) + 1 ) * sizeof( int64_t ) ) > DL_PLY_BUFFER ) {
+
+                /* export chunk to stream */
+                dl_stream.write( ( char * ) dl_obuffer, dl_export );
+
+                /* reset exportation offset */
+                dl_export = 0;
+
+            }
+
+            /* encode face vertex count */
+            dl_export += dl_ply_ascii_encode( dl_obuffer + dl_export, py_ftype[DL_FACE_LIST], dl_vcount );
+
+            /* transcoding face vertex value */
+            for ( le_size_t dl_vertex( 0 ); dl_vertex < le_size_t( dl_vcount ); dl_vertex ++ ) {
+
+                /* encode vertex index */
+                dl_export += dl_ply_ascii_encode( dl_obuffer + dl_export, py_ftype[DL_FACE_VERTEX], dl_ply_ascii_read() );
+
+            }
+
+        }
+
+        /* export chunk to stream */
+        dl_stream.write( ( char * ) dl_obuffer, dl_export );
+
+        /* check transcoded stream */
+        if ( dl_stream.fail() == true ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_WRITE );
+
+        }
+
+        /* delete transcoded stream */
+        dl_stream.close();
+
+        /* release buffer memory */
+        delete [] dl_obuffer;
+
+        /* release buffer memory */
+        delete [] py_buffer;
+
+        /* reset buffer */
+        py_buffer = nullptr;
 
-        /* read vertex record */
-        py_stream.read( ( char * ) dl_buffer, py_vsize );
+        /* reset buffer state */
+        py_bhead = py_btail = 0;
+
+        /* delete stream */
+        py_stream.close();
+
+        /* create stream */
+        py_stream.open( py_spill, std::ios::in | std::ios::binary );
+
+        /* check stream */
+        if ( py_stream.is_open() == false ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* delete cache descriptor */
+        close( py_handle );
+
+        /* create cache descriptor */
+        if ( ( py_handle = open( py_spill.c_str(), O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
 
         /* update offset */
-        py_stream.seekg( dl_offset, std::ios::beg );
+        py_offset = 0;
+
+        /* update format */
+        py_format = DL_FORMAT_BINLE;
+
+    }
+
+    le_real_t dl_ply_t::dl_ply_ascii_read() {
+
+        /* value variable */
+        le_real_t dl_value( 0.0 );
+
+        /* parsing variable */
+        char const * dl_parse( nullptr );
+
+        /* check buffer state */
+        if ( ( py_btail - py_bhead ) < DL_PLY_TOKEN ) dl_ply_ascii_fill();
+
+        /* skip separators */
+        while ( ( py_bhead < py_btail ) && ( py_buffer[py_bhead] <= ' ' ) ) {
+
+            /* update buffer head */
+            py_bhead ++;
+
+            /* check buffer state */
+            if ( ( py_btail - py_bhead ) < DL_PLY_TOKEN ) dl_ply_ascii_fill();
+
+        }
+
+        /* check buffer */
+        if ( py_bhead == py_btail ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
+
+        }
+
+        /* parse value */
+        dl_parse = lc_parse_real( ( char * ) py_buffer + py_bhead, dl_value );
+
+        /* check parsing */
+        if ( dl_parse == ( ( char * ) py_buffer + py_bhead ) ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* update buffer head */
+        py_bhead = dl_parse - ( char * ) py_buffer;
+
+        /* return parsed value */
+        return( dl_value );
+
+    }
+
+    le_void_t dl_ply_t::dl_ply_ascii_fill() {
+
+        /* move unread bytes */
+        std::memmove( py_buffer, py_buffer + py_bhead, py_btail - py_bhead );
+
+        /* update buffer tail */
+        py_btail -= py_bhead;
+
+        /* reset buffer head */
+        py_bhead = 0;
+
+        /* complete buffer */
+        py_stream.read( ( char * ) py_buffer + py_btail, DL_PLY_BUFFER - py_btail );
+
+        /* update buffer tail */
+        py_btail += py_stream.gcount();
+
+        /* terminate buffer */
+        py_buffer[py_btail] = 0;
+
+    }
+
+    le_size_t dl_ply_t::dl_ply_ascii_encode( le_byte_t * const dl_data, le_enum_t const dl_type, le_real_t const dl_value ) {
+
+        /* switch on type */
+        switch ( dl_type ) {
+
+            case ( DL_TYPE_FLOAT ) : {
+
+                /* encoding variable */
+                float dl_encode( dl_value );
+
+                /* encode value */
+                std::memcpy( dl_data, & dl_encode, sizeof( float ) );
+
+                /* return length */
+                return( sizeof( float ) );
+
+            } break;
+
+            case ( DL_TYPE_DOUBLE ) : {
+
+                /* encoding variable */
+                double dl_encode( dl_value );
+
+                /* encode value */
+                std::memcpy( dl_data, & dl_encode, sizeof( double ) );
+
+                /* return length */
+                return( sizeof( double ) );
+
+            } break;
+
+            case ( DL_TYPE_CHAR ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < int8_t > ( dl_data, dl_value ) );
+
+            } break;
+
+            case ( DL_TYPE_UCHAR ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < uint8_t > ( dl_data, dl_value ) );
+
+            } break;
+
+            case ( DL_TYPE_SHORT ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < int16_t > ( dl_data, dl_value ) );
+
+            } break;
+
+            case ( DL_TYPE_USHORT ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < uint16_t > ( dl_data, dl_value ) );
+
+            } break;
+
+            case ( DL_TYPE_INT ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < int32_t > ( dl_data, dl_value ) );
+
+            } break;
+
+            case ( DL_TYPE_UINT ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < uint32_t > ( dl_data, dl_value ) );
+
+            } break;
+
+            case ( DL_TYPE_LONG ) : {
+
+                /* encode value and return length */
+                return( dl_ply_ascii_integer < int64_t > ( dl_data, dl_value ) );
+
+            } break;
+
+        };
+
+        /* send message */
+        throw( LC_ERROR_FORMAT );
+
+    }
+
+    template < typename dl_type_t >
+    le_size_t dl_ply_t::dl_ply_ascii_integer( le_byte_t * const dl_data, le_real_t const dl_value ) {
+
+        /* encoding variable */
+        dl_type_t dl_encode( 0 );
+
+        /* check value range */
+        if ( ! ( ( dl_value >= le_real_t( std::numeric_limits < dl_type_t >::min() ) ) && ( dl_value < le_real_t( std::numeric_limits < dl_type_t >::max() ) + 1.0 ) ) ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* convert value */
+        dl_encode = dl_type_t( dl_value );
+
+        /* encode value */
+        std::memcpy( dl_data, & dl_encode, sizeof( dl_type_t ) );
+
+        /* return length */
+        return( sizeof( dl_type_t ) );
+
+    }
+
+/*
+    source - cache methods
+ */
+
+    le_byte_t * dl_ply_t::dl_ply_cache_vertex( le_size_t const dl_index ) {
+
+        /* page variable */
+        le_size_t dl_page( dl_index / DL_PLY_PAGE );
+
+        /* frame variable */
+        le_size_t dl_frame( py_ctable[dl_page] );
+
+        /* check page residency */
+        if ( dl_frame == DL_PLY_NONE ) {
+
+            /* update statistics */
+            py_cmiss ++;
+
+            /* load page */
+            dl_frame = dl_ply_cache_page( dl_page );
+
+        } else {
+
+            /* update statistics */
+            py_chits ++;
+
+        }
+
+        /* update frame reference */
+        py_cflag[dl_frame] = 1;
+
+        /* return vertex record */
+        return( py_cache + ( dl_frame * DL_PLY_PAGE + ( dl_index % DL_PLY_PAGE ) ) * LE_ARRAY_DATA );
+
+    }
+
+    le_size_t dl_ply_t::dl_ply_cache_page( le_size_t const dl_page ) {
+
+        /* frame variable */
+        le_size_t dl_frame( 0 );
+
+        /* vertex count variable */
+        le_size_t dl_count( std::min( le_size_t( DL_PLY_PAGE ), py_vcount - dl_page * DL_PLY_PAGE ) );
+
+        /* reading variable */
+        le_size_t dl_read( 0 );
+
+        /* reading variable */
+        ssize_t dl_size( 0 );
+
+        /* clock eviction - skip referenced frames */
+        while ( py_cflag[py_chand] != 0 ) {
+
+            /* clear frame reference */
+            py_cflag[py_chand] = 0;
+
+            /* update clock hand */
+            py_chand = ( py_chand + 1 ) % py_cframe;
+
+        }
+
+        /* assign frame */
+        dl_frame = py_chand;
+
+        /* update clock hand */
+        py_chand = ( py_chand + 1 ) % py_cframe;
+
+        /* check frame occupation */
+        if ( py_cpage[dl_frame] != DL_PLY_NONE ) {
+
+            /* evict page */
+            py_ctable[py_cpage[dl_frame]] = DL_PLY_NONE;
+
+        }
+
+        /* read page records */
+        while ( dl_read < dl_count * py_vsize ) {
+
+            /* read records part */
+            if ( ( dl_size = pread( py_handle, py_craw + dl_read, dl_count * py_vsize - dl_read, py_offset + dl_page * DL_PLY_PAGE * py_vsize + dl_read ) ) <= 0 ) {
+
+                /* check interruption */
+                if ( ( dl_size < 0 ) && ( errno == EINTR ) ) continue;
+
+                /* send message */
+                throw( LC_ERROR_IO_READ );
+
+            }
+
+            /* update reading */
+            dl_read += dl_size;
+
+        }
+
+        /* check byte order */
+        if ( py_format == DL_FORMAT_BINBE ) dl_ply_vertex_swap( py_craw, dl_count );
+
+        /* page decoding */
+        dl_ply_vertex_block( py_craw, dl_count, py_cache + dl_frame * DL_PLY_PAGE * LE_ARRAY_DATA );
+
+        /* update page table */
+        py_ctable[dl_page] = dl_frame;
+
+        /* update frame page */
+        py_cpage[dl_frame] = dl_page;
+
+        /* return frame */
+        return( dl_frame );
 
     }
 
@@ -558,7 +1235,15 @@
     source - conversion methods
  */
 
-    le_void_t dl_ply_t::dl_ply_convert( std::fstream & dl_stream ) {
+    le_void_t dl_ply_t::dl_ply_convert( std::fstream & dl_stream, char const * const dl_root ) {
+
+        /* check format */
+        if ( py_format == DL_FORMAT_ASCII ) {
+
+            /* transcode stream */
+            dl_ply_ascii( dl_root );
+
+        }
 
         /* check primitive count */
         if ( py_fcount == 0 ) {
@@ -595,9 +1280,6 @@
         /* buffer pointer variable */
         le_real_t * dl_uv3p( nullptr );
 
-        /* buffer pointer variable */
-        le_data_t * dl_uv3d( nullptr );
-
         /* allocate buffer memory */
         if ( ( dl_ibuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * py_vsize] ) == nullptr ) {
 
@@ -632,35 +1314,36 @@
                 /* reset exportation offset */
                 dl_export = 0;
 
-                /* chunk conversion */
-                for ( le_size_t dl_index( 0 ); dl_index < dl_read; dl_index += py_vsize ) {
+                /* check byte order */
+                if ( py_format == DL_FORMAT_BINBE ) dl_ply_vertex_swap( dl_ibuffer, dl_read / py_vsize );
 
-                    /* compute buffer pointer */
-                    dl_uv3p = ( le_real_t * ) ( dl_obuffer + dl_export );
+                /* chunk decoding */
+                dl_ply_vertex_block( dl_ibuffer, dl_read / py_vsize, dl_obuffer );
 
-                    /* compute buffer pointer */
-                    dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
+                /* chunk filtering */
+                for ( le_size_t dl_index( 0 ); dl_index < ( dl_read / py_vsize ) * LE_ARRAY_DATA; dl_index += LE_ARRAY_DATA ) {
 
-                    /* assign position coordinates */
-                    dl_uv3p[0] = dl_ply_vertex_float( dl_ibuffer, dl_index, DL_VERTEX_X );
-                    dl_uv3p[1] = dl_ply_vertex_float( dl_ibuffer, dl_index, DL_VERTEX_Y );
-                    dl_uv3p[2] = dl_ply_vertex_float( dl_ibuffer, dl_index, DL_VERTEX_Z );
+                    /* compute buffer pointer */
+                    dl_uv3p = ( le_real_t * ) ( dl_obuffer + dl_index );
 
                     /* vertex filtering - avoiding nan */
                     if ( dl_uv3p[0] != dl_uv3p[0] ) continue;
                     if ( dl_uv3p[1] != dl_uv3p[1] ) continue;
                     if ( dl_uv3p[2] != dl_uv3p[2] ) continue;
 
-                    /* validate record */
-                    dl_export += LE_ARRAY_DATA;
+                    /* check record position */
+                    if ( dl_export != dl_index ) {
+
+                        /* compact record */
+                        std::memcpy( dl_obuffer + dl_export, dl_obuffer + dl_index, LE_ARRAY_DATA );
+
+                    }
 
                     /* assign primitive type */
-                    dl_uv3d[0] = LE_UV3_POINT;
+                    dl_obuffer[dl_export + LE_ARRAY_DATA_POSE] = LE_UV3_POINT;
 
-                    /* assign primitive color */
-                    dl_uv3d[1] = dl_ply_vertex_integer( dl_ibuffer, dl_index, DL_VERTEX_R );
-                    dl_uv3d[2] = dl_ply_vertex_integer( dl_ibuffer, dl_index, DL_VERTEX_G );
-                    dl_uv3d[3] = dl_ply_vertex_integer( dl_ibuffer, dl_index, DL_VERTEX_B );
+                    /* validate record */
+                    dl_export += LE_ARRAY_DATA;
 
                 }
 
@@ -684,26 +1367,42 @@
 
     le_void_t dl_ply_t::dl_ply_convert_mesh( std::fstream & dl_stream ) {
 
-        /* buffer variable */
-        le_byte_t * dl_ibuffer( nullptr );
-
         /* buffer variable */
         le_byte_t * dl_obuffer( nullptr );
 
+        /* exportation variable */
+        le_size_t dl_export( 0 );
+
         /* vertex count variable */
         le_size_t dl_vcount( 0 );
 
         /* vertex index variable */
         le_size_t dl_vindex( 0 );
 
-        /* buffer pointer variable */
-        le_real_t * dl_uv3p( nullptr );
+        /* page count variable */
+        le_size_t dl_pages( ( py_vcount + DL_PLY_PAGE - 1 ) / DL_PLY_PAGE );
 
-        /* buffer pointer variable */
-        le_data_t * dl_uv3d( nullptr );
+        /* compute cache frames */
+        py_cframe = std::min( dl_pages, std::max( py_memory / ( DL_PLY_PAGE * LE_ARRAY_DATA ), le_size_t( 1 ) ) );
 
         /* allocate buffer memory */
-        if ( ( dl_ibuffer = new ( std::nothrow ) le_byte_t[py_vsize] ) == nullptr ) {
+        if ( ( dl_obuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* allocate cache memory */
+        if ( ( py_cache = new ( std::nothrow ) le_byte_t[py_cframe * DL_PLY_PAGE * LE_ARRAY_DATA] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* allocate cache memory */
+        if ( ( py_craw = new ( std::nothrow ) le_byte_t[DL_PLY_PAGE * py_vsize] ) == nullptr ) {
 
             /* send message */
             throw( LC_ERROR_MEMORY );
@@ -711,18 +1410,21 @@
         }
 
         /* allocate buffer memory */
-        if ( ( dl_obuffer = new ( std::nothrow ) le_byte_t[LE_ARRAY_DATA] ) == nullptr ) {
+        if ( ( py_buffer = new ( std::nothrow ) le_byte_t[DL_PLY_BUFFER] ) == nullptr ) {
 
             /* send message */
             throw( LC_ERROR_MEMORY );
 
         }
 
-        /* create buffer pointer */
-        dl_uv3p = ( le_real_t * ) ( dl_obuffer );
+        /* initialise page table */
+        py_ctable.assign( dl_pages, DL_PLY_NONE );
+
+        /* initialise frames page */
+        py_cpage.assign( py_cframe, DL_PLY_NONE );
 
-        /* create buffer pointer */
-        dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
+        /* initialise frames reference */
+        py_cflag.assign( py_cframe, 0 );
 
         /* clear stream */
         py_stream.clear();
@@ -731,7 +1433,7 @@
         py_stream.seekg( py_offset + ( py_vcount * py_vsize ), std::ios::beg );
 
         /* parsing faces */
-        for ( le_size_t dl_parse( 0 ); dl_parse < py_fcount; dl_parse ++ ) {
+        for ( le_size_t dl_face( 0 ); dl_face < py_fcount; dl_face ++ ) {
 
             /* read face vertex count */
             dl_vcount = dl_ply_io_integer( py_ftype[DL_FACE_LIST] );
@@ -742,34 +1444,177 @@
                 /* read vertex index */
                 dl_vindex = dl_ply_io_integer( py_ftype[DL_FACE_VERTEX] );
 
-                /* read vertex */
-                dl_ply_io_vertex( dl_vindex, dl_ibuffer );
+                /* check consistency */
+                if ( dl_vindex >= py_vcount ) {
 
-                /* assign position coordinates */
-                dl_uv3p[0] = dl_ply_vertex_float( dl_ibuffer, 0, DL_VERTEX_X );
-                dl_uv3p[1] = dl_ply_vertex_float( dl_ibuffer, 0, DL_VERTEX_Y );
-                dl_uv3p[2] = dl_ply_vertex_float( dl_ibuffer, 0, DL_VERTEX_Z );
+                    /* send message */
+                    throw( LC_ERROR_FORMAT );
+
+                }
+
+                /* gather vertex record */
+                std::memcpy( dl_obuffer + dl_export, dl_ply_cache_vertex( dl_vindex ), LE_ARRAY_DATA );
 
                 /* assign primitive type */
-                dl_uv3d[0] = dl_vcount;
+                dl_obuffer[dl_export + LE_ARRAY_DATA_POSE] = dl_vcount;
+
+                /* check buffer state */
+                if ( ( dl_export += LE_ARRAY_DATA ) == ( LE_UV3_CHUNK * LE_ARRAY_DATA ) ) {
 
-                /* assign primitive color */
-                dl_uv3d[1] = dl_ply_vertex_integer( dl_ibuffer, 0, DL_VERTEX_R );
-                dl_uv3d[2] = dl_ply_vertex_integer( dl_ibuffer, 0, DL_VERTEX_G );
-                dl_uv3d[3] = dl_ply_vertex_integer( dl_ibuffer, 0, DL_VERTEX_B );
+                    /* export chunk to stream */
+                    dl_stream.write( ( char * ) dl_obuffer, dl_export );
 
-                /* export record to stream */
-                dl_stream.write( ( char * ) dl_obuffer, LE_ARRAY_DATA );
+                    /* reset exportation offset */
+                    dl_export = 0;
+
+                }
 
             }
 
         }
 
+        /* export chunk to stream */
+        dl_stream.write( ( char * ) dl_obuffer, dl_export );
+
+        /* display cache statistics */
+        std::cerr << "dalai-ply-uv3 : vertex cache : " << py_chits << " hits, " << py_cmiss << " misses, " << py_cframe << "/" << dl_pages << " pages" << std::endl;
+
         /* release buffer memory */
         delete [] dl_obuffer;
 
-        /* release buffer memory */
-        delete [] dl_ibuffer;
+    }
+
+    le_void_t dl_ply_t::dl_ply_vertex_swap( le_byte_t * const dl_buffer, le_size_t const dl_count ) {
+
+        /* property length variable */
+        le_size_t dl_length[6] = { 0 };
+
+        /* parsing property */
+        for ( le_size_t dl_parse( 0 ); dl_parse < 6; dl_parse ++ ) {
+
+            /* compute property length */
+            dl_length[dl_parse] = ( py_vtype[dl_parse] == DL_TYPE_NONE ) ? 1 : dl_ply_type_length( py_vtype[dl_parse] );
+
+        }
+
+        /* parsing vertex */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+            /* parsing property */
+            for ( le_size_t dl_vertex( 0 ); dl_vertex < 6; dl_vertex ++ ) {
+
+                /* swap property value */
+                dl_ply_io_swap( dl_buffer + dl_parse * py_vsize + py_vdata[dl_vertex], dl_length[dl_vertex] );
+
+            }
+
+        }
+
+    }
+
+    le_void_t dl_ply_t::dl_ply_vertex_block( le_byte_t const * const dl_ibuffer, le_size_t const dl_count, le_byte_t * const dl_obuffer ) {
+
+        /* switch on kernel */
+        switch ( py_decode ) {
+
+            case ( DL_DECODE_FLOAT ) : {
+
+                /* specialised decoding */
+                dl_ply_vertex_kernel < float > ( dl_ibuffer, dl_count, dl_obuffer );
+
+            } break;
+
+            case ( DL_DECODE_DOUBLE ) : {
+
+                /* specialised decoding */
+                dl_ply_vertex_kernel < double > ( dl_ibuffer, dl_count, dl_obuffer );
+
+            } break;
+
+            default : {
+
+                /* generic decoding */
+                for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+                    /* decode vertex record */
+                    dl_ply_vertex_decode( dl_ibuffer, dl_parse * py_vsize, dl_obuffer + dl_parse * LE_ARRAY_DATA );
+
+                }
+
+            } break;
+
+        };
+
+    }
+
+    template < typename dl_type_t >
+    le_void_t dl_ply_t::dl_ply_vertex_kernel( le_byte_t const * const dl_ibuffer, le_size_t const dl_count, le_byte_t * const dl_obuffer ) {
+
+        /* property offset variable */
+        le_size_t const dl_x( py_vdata[DL_VERTEX_X] );
+        le_size_t const dl_y( py_vdata[DL_VERTEX_Y] );
+        le_size_t const dl_z( py_vdata[DL_VERTEX_Z] );
+
+        /* property offset variable */
+        le_size_t const dl_r( py_vdata[DL_VERTEX_R] );
+        le_size_t const dl_g( py_vdata[DL_VERTEX_G] );
+        le_size_t const dl_b( py_vdata[DL_VERTEX_B] );
+
+        /* record size variable */
+        le_size_t const dl_size( py_vsize );
+
+        /* buffer pointer variable */
+        le_byte_t const * dl_vertex( nullptr );
+
+        /* buffer pointer variable */
+        le_real_t * dl_uv3p( nullptr );
+
+        /* buffer pointer variable */
+        le_data_t * dl_uv3d( nullptr );
+
+        /* parsing vertex */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_count; dl_parse ++ ) {
+
+            /* compute buffer pointer */
+            dl_vertex = dl_ibuffer + dl_parse * dl_size;
+
+            /* compute buffer pointer */
+            dl_uv3p = ( le_real_t * ) ( dl_obuffer + dl_parse * LE_ARRAY_DATA );
+
+            /* compute buffer pointer */
+            dl_uv3d = ( le_data_t * ) ( dl_uv3p + 3 );
+
+            /* assign position coordinates */
+            dl_uv3p[0] = * ( ( dl_type_t const * ) ( dl_vertex + dl_x ) );
+            dl_uv3p[1] = * ( ( dl_type_t const * ) ( dl_vertex + dl_y ) );
+            dl_uv3p[2] = * ( ( dl_type_t const * ) ( dl_vertex + dl_z ) );
+
+            /* assign primitive color */
+            dl_uv3d[1] = dl_vertex[dl_r];
+            dl_uv3d[2] = dl_vertex[dl_g];
+            dl_uv3d[3] = dl_vertex[dl_b];
+
+        }
+
+    }
+
+    le_void_t dl_ply_t::dl_ply_vertex_decode( le_byte_t const * const dl_buffer, le_size_t const dl_offset, le_byte_t * const dl_record ) {
+
+        /* buffer pointer variable */
+        le_real_t * dl_uv3p( ( le_real_t * ) dl_record );
+
+        /* buffer pointer variable */
+        le_data_t * dl_uv3d( ( le_data_t * ) ( dl_uv3p + 3 ) );
+
+        /* assign position coordinates */
+        dl_uv3p[0] = dl_ply_vertex_float( dl_buffer, dl_offset, DL_VERTEX_X );
+        dl_uv3p[1] = dl_ply_vertex_float( dl_buffer, dl_offset, DL_VERTEX_Y );
+        dl_uv3p[2] = dl_ply_vertex_float( dl_buffer, dl_offset, DL_VERTEX_Z );
+
+        /* assign primitive color */
+        dl_uv3d[1] = dl_ply_vertex_integer( dl_buffer, dl_offset, DL_VERTEX_R );
+        dl_uv3d[2] = dl_ply_vertex_integer( dl_buffer, dl_offset, DL_VERTEX_G );
+        dl_uv3d[3] = dl_ply_vertex_integer( dl_buffer, dl_offset, DL_VERTEX_B );
 
     }
 
@@ -908,7 +1753,7 @@
     try {
 
         /* ply-object variable */
-        dl_ply_t dl_istream( ( le_char_t * ) lc_read_string( argc, argv, "--input", "-i" ) );
+        dl_ply_t dl_istream( ( le_char_t * ) lc_read_string( argc, argv, "--input", "-i" ), lc_read_unsigned( argc, argv, "--memory", "-m", DL_PLY_MEMORY ) << 20 );
 
         /* create stream */
         dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
@@ -922,7 +1767,7 @@
         }
 
         /* ply-object conversion */
-        dl_istream.dl_ply_convert( dl_ostream );
+        dl_istream.dl_ply_convert( dl_ostream, lc_read_string( argc, argv, "--temporary", "-y" ) );
 
         /* delete stream */
         dl_ostream.close();
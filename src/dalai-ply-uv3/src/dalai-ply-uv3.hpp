@@ -54,6 +54,14 @@
 
     # include <iostream>
     # include <fstream>
+    # include <cstring>
+    # include <cstdio>
+    # include <algorithm>
+    # include <vector>
+    # include <limits>
+    # include <cerrno>
+    # include <fcntl.h>
+    # include <unistd.h>
     # include <common-include.hpp>
     # include <eratosthene-include.h>
 
@@ -97,6 +105,31 @@
     # define DL_FACE_LIST     ( 0 )
     # define DL_FACE_VERTEX   ( 1 )
 
+    /* define stream format */
+    # define DL_FORMAT_BINLE  ( 0 )
+    # define DL_FORMAT_BINBE  ( 1 )
+    # define DL_FORMAT_ASCII  ( 2 )
+
+    /* define vertex decoding kernel */
+    # define DL_DECODE_GENERIC ( 0 )
+    # define DL_DECODE_FLOAT   ( 1 )
+    # define DL_DECODE_DOUBLE  ( 2 )
+
+    /* define face reading buffer */
+    # define DL_PLY_BUFFER    ( 1048576 )
+
+    /* define ascii token maximum length */
+    # define DL_PLY_TOKEN     ( 256 )
+
+    /* define vertex cache page - vertex */
+    # define DL_PLY_PAGE      ( 16384 )
+
+    /* define vertex cache memory - mebibytes */
+    # define DL_PLY_MEMORY    ( 4096 )
+
+    /* define vertex cache empty entry */
+    # define DL_PLY_NONE      ( ~ le_size_t( 0 ) )
+
 /*
     header - preprocessor macros
  */
@@ -121,10 +154,14 @@
      *
      *  \var dl_ply_t::py_stream
      *  Stream descriptor to ply file
+     *  \var dl_ply_t::py_handle
+     *  Descriptor to ply file, used by the vertex cache to read its pages
      *  \var dl_ply_t::py_vcount
      *  Amount of vertex
      *  \var dl_ply_t::py_fcount
      *  Amount of faces
+     *  \var dl_ply_t::py_format
+     *  Format of the ply stream content
      *  \var dl_ply_t::py_offset
      *  Offset, in bytes, of the first byte outside of the header
      *  \var dl_ply_t::py_vsize
@@ -137,6 +174,40 @@
      *  Types of the vertex property
      *  \var dl_ply_t::py_ftype
      *  Types of the faces property
+     *  \var dl_ply_t::py_vlist
+     *  Types of all the vertex property, in record order
+     *  \var dl_ply_t::py_buffer
+     *  Reading buffer of the faces
+     *  \var dl_ply_t::py_bhead
+     *  Offset, in bytes, of the next byte to read in the buffer
+     *  \var dl_ply_t::py_btail
+     *  Amount of bytes available in the buffer
+     *  \var dl_ply_t::py_memory
+     *  Memory budget, in bytes, of the vertex cache
+     *  \var dl_ply_t::py_cache
+     *  Vertex cache frames, holding pages of decoded uv3 records
+     *  \var dl_ply_t::py_craw
+     *  Vertex cache reading buffer, holding one page of ply records
+     *  \var dl_ply_t::py_ctable
+     *  Vertex cache page table, giving the frame of each resident page
+     *  \var dl_ply_t::py_cpage
+     *  Vertex cache frames page
+     *  \var dl_ply_t::py_cflag
+     *  Vertex cache frames reference flag
+     *  \var dl_ply_t::py_cframe
+     *  Vertex cache number of frames
+     *  \var dl_ply_t::py_chand
+     *  Vertex cache clock hand
+     *  \var dl_ply_t::py_chits
+     *  Vertex cache hits count
+     *  \var dl_ply_t::py_cmiss
+     *  Vertex cache misses count
+     *  \var dl_ply_t::py_decode
+     *  Vertex decoding kernel selected from the header layout
+     *  \var dl_ply_t::py_path
+     *  Path of the temporary directory holding the transcoded stream
+     *  \var dl_ply_t::py_spill
+     *  Path of the transcoded stream, empty if not transcoded
      */
 
     class dl_ply_t {
@@ -144,9 +215,11 @@
         private:
 
             std::fstream py_stream;
+            int          py_handle;
 
             le_size_t py_vcount;
             le_size_t py_fcount;
+            le_enum_t py_format;
             le_size_t py_offset;
             le_size_t py_vsize;
 
@@ -156,26 +229,54 @@
             le_enum_t py_vtype[6];
             le_enum_t py_ftype[2];
 
+            std::vector < le_enum_t > py_vlist;
+
+            le_byte_t * py_buffer;
+            le_size_t   py_bhead;
+            le_size_t   py_btail;
+
+            le_size_t   py_memory;
+            le_byte_t * py_cache;
+            le_byte_t * py_craw;
+
+            std::vector < le_size_t > py_ctable;
+            std::vector < le_size_t > py_cpage;
+            std::vector < le_byte_t > py_cflag;
+
+            le_size_t py_cframe;
+            le_size_t py_chand;
+            le_size_t py_chits;
+            le_size_t py_cmiss;
+
+            le_enum_t py_decode;
+
+            le_char_t   py_path[_LE_USE_PATH];
+            std::string py_spill;
+
         public:
 
         /*! \brief constructor/destructor methods
          *
          *  The constructor starts by initialising the ply format descriptor
          *  arrays for both face and vertex elements. It then creates the stream
-         *  descriptor towards the ply file.
+         *  descriptor towards the ply file and the descriptor through which the
+         *  vertex cache reads its pages.
          *
          *  The constructor ends by reading the header of the ply stream using
          *  the \b dl_ply_header() method.
          *
-         *  \param dl_path Path to the ply stream
+         *  \param dl_path   Path to the ply stream
+         *  \param dl_memory Memory budget of the vertex cache, in bytes
          */
 
-        dl_ply_t( le_char_t const * const dl_path );
+        dl_ply_t( le_char_t const * const dl_path, le_size_t const dl_memory );
 
         /*! \brief constructor/destructor methods
          *
-         *  The destructor simply deletes the stream descriptor toward the ply
-         *  file.
+         *  The destructor releases the faces reading buffer and the vertex cache,
+         *  if allocated, and deletes the descriptors toward the ply file.
+         *  If the ply stream was transcoded, the transcoded stream and its
+         *  temporary directory are removed.
          */
 
         ~dl_ply_t();
@@ -208,8 +309,9 @@
          *  This method is used to analyse the header of the ply file. It has
          *  to be called before any conversion process.
          *
-         *  The function checks if the provided ply file is in a readable format
-         *  and starts analysing the content in vertex and faces. For both
+         *  The function checks if the provided ply file is in a readable format,
+         *  that is binary, in both byte orders, or ascii, and starts analysing
+         *  the content in vertex and faces. For both
          *  vertex and faces, the function checks the specification format.
          *
          *  The objets members are updated according to the results of the ply
@@ -221,7 +323,8 @@
         /*! \brief header methods
          *
          *  This header complementary function reads the vertex property and
-         *  assign the corresponding representation to the object.
+         *  assign the corresponding representation to the object. The type of
+         *  each property is also pushed in the vertex property list.
          *
          *  \param dl_type Type of the property
          *  \param dl_word Property name string
@@ -240,11 +343,26 @@
 
         le_void_t dl_ply_header_face( le_enum_t const dl_list, le_enum_t const dl_type );
 
+        /*! \brief header methods
+         *
+         *  This header complementary function selects the vertex decoding
+         *  kernel according to the vertex layout found in the header.
+         *
+         *  If the colors are stored as unsigned bytes and the coordinates are
+         *  all stored as float or all as double, a specialised kernel is
+         *  selected. The generic kernel is selected otherwise.
+         */
+
+        le_void_t dl_ply_header_decode();
+
         /*! \brief i/o methods
          *
          *  This function is used to read, at the current ply stream offset, a
          *  specific integer type. The read value is returned by the function.
          *
+         *  The value is read through the faces reading buffer using the
+         *  \b dl_ply_io_read() method.
+         *
          *  \param dl_type Type to read
          *
          *  \return Returns read value
@@ -254,15 +372,131 @@
 
         /*! \brief i/o methods
          *
-         *  This function is used to read one record corresponding to a specific
-         *  vertex in the ply stream. The vertex record is read, according to
-         *  its length and is returned through the provided buffer.
+         *  This function reverses the byte order of the provided value, which
+         *  length is given in bytes. Lengths of one byte are left unchanged.
+         *
+         *  \param dl_data   Value bytes
+         *  \param dl_length Value length, in bytes
+         */
+
+        le_void_t dl_ply_io_swap( le_byte_t * const dl_data, le_size_t const dl_length );
+
+        /*! \brief i/o methods
+         *
+         *  This function reads the provided amount of bytes from the ply stream
+         *  through the faces reading buffer. The buffer is refilled with the
+         *  next DL_PLY_BUFFER bytes of the stream each time it is exhausted.
          *
-         *  \param dl_index  Index, zero-based and in bytes, of the vertex
-         *  \param dl_buffer Bytes buffer receiving the read vertex record
+         *  \param dl_data Bytes buffer receiving the read bytes
+         *  \param dl_size Amount of bytes to read
          */
 
-        le_void_t dl_ply_io_vertex( le_size_t const dl_index, le_byte_t * const dl_buffer );
+        le_void_t dl_ply_io_read( le_byte_t * const dl_data, le_size_t const dl_size );
+
+        /*! \brief ascii methods
+         *
+         *  This function transcodes the ascii content of the ply stream into a
+         *  binary little-endian stream written in a temporary directory. The
+         *  ply stream is then replaced by the transcoded one, allowing the
+         *  conversion methods to process it as any binary stream.
+         *
+         *  The ascii content is read by chunks through the faces reading buffer
+         *  and each value is parsed using the \b lc_parse_real() function. The
+         *  values are encoded according to the types found in the header and
+         *  written through a chunked buffer.
+         *
+         *  \param dl_root Temporary directory location, null pointer for default
+         */
+
+        le_void_t dl_ply_ascii( char const * const dl_root );
+
+        /*! \brief ascii methods
+         *
+         *  This function skips the separators found at the current position of
+         *  the ascii content and parses the next value, which is returned. The
+         *  reading buffer is refilled each time less than DL_PLY_TOKEN bytes
+         *  remain available, ensuring a complete token for the parser.
+         *
+         *  \return Returns parsed value
+         */
+
+        le_real_t dl_ply_ascii_read();
+
+        /*! \brief ascii methods
+         *
+         *  This function moves the unread bytes of the reading buffer at its
+         *  beginning and completes it with the next bytes of the ply stream.
+         *  The buffer content is always terminated by a null character.
+         */
+
+        le_void_t dl_ply_ascii_fill();
+
+        /*! \brief ascii methods
+         *
+         *  This function encodes the provided value according to the provided
+         *  type in the provided buffer, in little-endian byte order. The integer
+         *  types are encoded through the \b dl_ply_ascii_integer() method.
+         *
+         *  \param dl_data  Buffer receiving the value
+         *  \param dl_type  Type of the value
+         *  \param dl_value Value to encode
+         *
+         *  \return Returns the length, in bytes, of the encoded value
+         */
+
+        le_size_t dl_ply_ascii_encode( le_byte_t * const dl_data, le_enum_t const dl_type, le_real_t const dl_value );
+
+        /*! \brief ascii methods
+         *
+         *  This function encodes the provided value in the provided buffer as
+         *  an integer of the templated type, in little-endian byte order. The
+         *  value is truncated toward zero. A value that can not be represented
+         *  by the type, including a negative value for an unsigned type, is
+         *  rejected as a format error.
+         *
+         *  \param dl_data  Buffer receiving the value
+         *  \param dl_value Value to encode
+         *
+         *  \return Returns the length, in bytes, of the encoded value
+         */
+
+        template < typename dl_type_t >
+        le_size_t dl_ply_ascii_integer( le_byte_t * const dl_data, le_real_t const dl_value );
+
+        /*! \brief cache methods
+         *
+         *  This function returns a pointer to the decoded uv3 record of the
+         *  provided vertex. If the page of DL_PLY_PAGE vertex containing it is
+         *  not resident in the vertex cache, it is loaded using the
+         *  \b dl_ply_cache_page() method. The hits and misses are counted.
+         *
+         *  The returned record stays valid until the next call of the method.
+         *
+         *  \param dl_index Index of the vertex
+         *
+         *  \return Returns pointer to the vertex uv3 record
+         */
+
+        le_byte_t * dl_ply_cache_vertex( le_size_t const dl_index );
+
+        /*! \brief cache methods
+         *
+         *  This function loads the provided page of vertex in the vertex cache.
+         *  The frame receiving the page is selected using the CLOCK policy :
+         *  the clock hand skips and clears the referenced frames until it finds
+         *  an unreferenced one, evicting its page.
+         *
+         *  The ply records of the page are then read and decoded in the frame.
+         *  They are read, using positioned reads, through the descriptor of the
+         *  vertex cache, leaving the ply stream, and its buffer, untouched for
+         *  the reading of the faces.
+         *
+         *  \param dl_page Index of the page
+         *
+         *  \return Returns the frame holding the page
+         */
+
+        le_size_t dl_ply_cache_page( le_size_t const dl_page );
 
         public:
 
@@ -276,10 +510,14 @@
          *  performs a point-only conversion. If at least one face is found in
          *  the ply stream, a pure mesh conversion is then made.
          *
+         *  Ascii ply streams are first transcoded in binary form, using the
+         *  \b dl_ply_ascii() method, in a temporary directory.
+         *
          *  \param dl_stream Conversion output stream descriptor
+         *  \param dl_root   Temporary directory location, null pointer for default
          */
 
-        le_void_t dl_ply_convert( std::fstream & dl_stream );
+        le_void_t dl_ply_convert( std::fstream & dl_stream, char const * const dl_root );
 
         private:
 
@@ -287,7 +525,8 @@
          *
          *  This method is specialised in point-based conversion from ply to uv3
          *  format. It reads ply vertex by chunks and converts them into uv3
-         *  chunks before to exports them in the provided output stream.
+         *  chunks before to exports them in the provided output stream. The
+         *  vertex with non-numerical coordinates are discarded.
          *
          *  \param dl_stream Conversion output stream descriptor
          */
@@ -297,15 +536,81 @@
         /*! \brief conversion methods
          *
          *  This method is specialised in mesh-based conversion from ply to uv3
-         *  format. It reads each face index list and converts them into uv3
-         *  polygonal record before to export them in the specified output
-         *  stream.
+         *  format. It reads each face index list, through the faces reading
+         *  buffer, and gathers the indexed records from the vertex cache into
+         *  uv3 polygonal records before to export them by chunks in the
+         *  specified output stream.
+         *
+         *  The vertex cache is sized according to the memory budget, holding
+         *  the whole vertex block when possible. The cache statistics are
+         *  displayed at the end of the conversion.
          *
          *  \param dl_stream Conversion output stream descriptor
          */
 
         le_void_t dl_ply_convert_mesh( std::fstream & dl_stream );
 
+        /*! \brief conversion methods
+         *
+         *  This function decodes the vertex stored in the provided buffer at
+         *  the provided offset into an uv3 record. The position and the color
+         *  of the record are assigned while its type is left unchanged.
+         *
+         *  \param dl_buffer Vertex record buffer
+         *  \param dl_offset Vertex offset in the buffer, in bytes
+         *  \param dl_record UV3 record receiving the vertex
+         */
+
+        le_void_t dl_ply_vertex_decode( le_byte_t const * const dl_buffer, le_size_t const dl_offset, le_byte_t * const dl_record );
+
+        /*! \brief conversion methods
+         *
+         *  This function reverses, in place, the byte order of the position and
+         *  color properties of the provided amount of consecutive vertex. It is
+         *  used to bring big-endian records in the host byte order before their
+         *  decoding.
+         *
+         *  Only the six decoded properties, x, y, z, red, green and blue, are
+         *  swapped : any other vertex property is left in big-endian order and
+         *  has not to be read from the swapped records.
+         *
+         *  \param dl_buffer Vertex records buffer
+         *  \param dl_count  Amount of vertex to swap
+         */
+
+        le_void_t dl_ply_vertex_swap( le_byte_t * const dl_buffer, le_size_t const dl_count );
+
+        /*! \brief conversion methods
+         *
+         *  This function decodes the provided amount of consecutive vertex
+         *  stored in the input buffer into uv3 records written in the output
+         *  buffer. The types of the records are left unchanged.
+         *
+         *  The decoding is performed by the kernel selected from the header
+         *  layout, the generic kernel relying on the \b dl_ply_vertex_decode()
+         *  method for each vertex.
+         *
+         *  \param dl_ibuffer Vertex records buffer
+         *  \param dl_count   Amount of vertex to decode
+         *  \param dl_obuffer UV3 records buffer
+         */
+
+        le_void_t dl_ply_vertex_block( le_byte_t const * const dl_ibuffer, le_size_t const dl_count, le_byte_t * const dl_obuffer );
+
+        /*! \brief conversion methods
+         *
+         *  This function implements the specialised decoding kernels. The type
+         *  of the coordinates being known at compile time and the colors being
+         *  unsigned bytes, the decoding loop is free of any type dispatch.
+         *
+         *  \param dl_ibuffer Vertex records buffer
+         *  \param dl_count   Amount of vertex to decode
+         *  \param dl_obuffer UV3 records buffer
+         */
+
+        template < typename dl_type_t >
+        le_void_t dl_ply_vertex_kernel( le_byte_t const * const dl_ibuffer, le_size_t const dl_count, le_byte_t * const dl_obuffer );
+
         /*! \brief conversion methods
          *
          *  This function is used to read the vertex property as a floating
@@ -347,6 +652,8 @@
      *
      *      ./dalai-ply-uv3 --input/-i [ply input file path]
      *                      --output/-o [uv3 output file path]
+     *                      --memory/-m [vertex cache memory, in MiB]
+     *                      --temporary/-y [temporary directory location]
      *
      *  The function starts by creating the class associated to the reading and
      *  analysis of the provided ply file. It then reads the content of the ply
@@ -355,12 +662,16 @@
      *  If the ply file contains only vertex, a specialised and fast function
      *  is used to converts the vertex into uv3 records. If the ply file
      *  contains at least one face, only line and triangles are converted and
-     *  exported in the output uv3 stream.
+     *  exported in the output uv3 stream. In this case, the vertex referenced
+     *  by the faces are accessed through a paged cache which size is bounded
+     *  by the provided memory budget.
      *
-     *  The converted ply file is always considered in its binary representation
-     *  and always considering little-endian byte order. In addition, the vertex
-     *  have to carry color information as the face colors are ignored by the
-     *  conversion process.
+     *  The converted ply file can be in binary representation, in both byte
+     *  orders, or in ascii representation. Big-endian records are swapped on
+     *  the fly while ascii files are first transcoded in binary representation
+     *  in a temporary directory, created in the provided location or in the
+     *  default one. In addition, the vertex have to carry color information as
+     *  the face colors are ignored by the conversion process.
      *
      *  \param argc Standard parameter
      *  \param argv Standard parameter
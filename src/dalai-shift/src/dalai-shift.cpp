@@ -27,7 +27,7 @@
 
     int main( int argc, char ** argv ) {
 
-        /* stream buffer variables */
+        /* stream chunk variable */
         le_byte_t * dl_buffer( nullptr );
 
         /* shift variable */
@@ -35,11 +35,17 @@
         le_real_t dl_yshift( lc_read_double( argc, argv, "--y", "-y", 0.0 ) );
         le_real_t dl_zshift( lc_read_double( argc, argv, "--z", "-z", 0.0 ) );
 
+        /* in-place variable */
+        bool dl_place( lc_read_flag( argc, argv, "--in-place", "-p" ) );
+
+        /* threads variable */
+        le_size_t dl_threads( lc_thread_count( lc_read_unsigned( argc, argv, "--threads", "-n", 0 ) ) );
+
         /* reading variable */
-        le_size_t dl_read( 1 );
+        le_size_t dl_read( 0 );
 
-        /* stream variable */
-        std::ifstream dl_istream;
+        /* records variable */
+        le_size_t dl_count( 0 );
 
         /* stream variable */
         std::ofstream dl_ostream;
@@ -47,55 +53,49 @@
     /* error management */
     try {
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
-
-        /* check input stream */
-        if ( dl_istream.is_open() != true ) {
+        /* create input stream reader */
+        lc_uv3_t dl_istream( lc_read_string( argc, argv, "--input", "-i" ), dl_place == true ? LC_UV3_WRITE : LC_UV3_READ );
 
-            /* send message */
-            throw( LC_ERROR_IO_READ );
+        /* check mode */
+        if ( dl_place == false ) {
 
-        }
-
-        /* create output stream */
-        dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+            /* create output stream */
+            dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
 
-        /* check output stream */
-        if ( dl_ostream.is_open() != true ) {
+            /* check output stream */
+            if ( dl_ostream.is_open() != true ) {
 
-            /* send message */
-            throw( LC_ERROR_IO_WRITE );
-
-        }
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
 
-        /* allocate buffer memory */
-        if ( ( dl_buffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
-
-            /* send message */
-            throw( LC_ERROR_MEMORY );
+            }
 
         }
 
         /* stream reading */
-        while ( dl_read != 0 ) {
+        while ( ( dl_read = dl_istream.uv_get_chunk( & dl_buffer ) ) > 0 ) {
 
-            /* read stream chunk */
-            dl_istream.read( ( char * ) dl_buffer, LE_UV3_CHUNK * LE_ARRAY_DATA );
+            /* compute chunk records */
+            dl_count = dl_read / LE_ARRAY_DATA;
 
-            /* check read bytes */
-            if ( ( dl_read = dl_istream.gcount() ) > 0 ) {
+            /* parsing chunk slices */
+            lc_thread( dl_threads, dl_threads, [&] ( le_size_t const dl_slice ) {
 
-                /* parsing chunk */
-                for ( le_size_t dl_parse( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA ) {
+                /* parsing slice records */
+                for ( le_size_t dl_parse( ( dl_count * dl_slice ) / dl_threads ); dl_parse < ( dl_count * ( dl_slice + 1 ) ) / dl_threads; dl_parse ++ ) {
 
                     /* apply shift on coordinates */
-                    ( ( le_real_t * ) ( dl_buffer + dl_parse ) )[0] += dl_xshift;
-                    ( ( le_real_t * ) ( dl_buffer + dl_parse ) )[1] += dl_yshift;
-                    ( ( le_real_t * ) ( dl_buffer + dl_parse ) )[2] += dl_zshift;
+                    ( ( le_real_t * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA ) )[0] += dl_xshift;
+                    ( ( le_real_t * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA ) )[1] += dl_yshift;
+                    ( ( le_real_t * ) ( dl_buffer + dl_parse * LE_ARRAY_DATA ) )[2] += dl_zshift;
 
                 }
 
+            } );
+
+            /* check mode */
+            if ( dl_place == false ) {
+
                 /* write stream chunk */
                 dl_ostream.write( ( char * ) dl_buffer, dl_read );
 
@@ -103,14 +103,18 @@
 
         }
 
-        /* delete stream buffer */
-        delete[] dl_buffer;
+        /* check mode */
+        if ( dl_place == true ) {
 
-        /* delete output stream */
-        dl_ostream.close();
+            /* synchronise input stream */
+            dl_istream.uv_set_sync();
 
-        /* delete input stream */
-        dl_istream.close();
+        } else {
+
+            /* delete output stream */
+            dl_ostream.close();
+
+        }
 
     /* error management */
     } catch ( int dl_code ) {
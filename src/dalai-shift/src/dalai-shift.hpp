@@ -87,6 +87,8 @@
      *                    --x/-x [x-dimension shift]
      *                    --y/-y [y-dimension shift]
      *                    --z/-z [z-dimension shift]
+     *                    --in-place/-p [in-place transformation switch]
+     *                    --threads/-n [number of threads]
      *
      *  The main function starts by opening both input and output files before
      *  to read the input stream chunk by chunk. The provided shift values are
@@ -99,6 +101,12 @@
      *  The processed chunks are then exported one by one in the created output
      *  file.
      *
+     *  With the in-place switch, no output file is created and the input file
+     *  is mapped writable, the records being modified directly in the mapping
+     *  and written back by the system. The records of each chunk are split in
+     *  equal slices processed by the specified number of threads, zero meaning
+     *  the number of hardware threads.
+     *
      *  \param  argc Standard parameter
      *  \param  argv Standard parameter
      *
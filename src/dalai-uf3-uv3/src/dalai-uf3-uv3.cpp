@@ -22,130 +22,769 @@
     # include "dalai-uf3-uv3.hpp"
 
 /*
-    source - main methods
+    source - conversion methods
  */
 
-    int main( int argc, char ** argv ) {
+    le_void_t dl_uf3_repack( le_byte_t const * dl_input, le_byte_t * dl_output, le_size_t const dl_count ) {
 
-        /* buffer variable */
-        le_byte_t * dl_ibuffer( nullptr );
+        /* records boundary variable */
+        le_byte_t const * const dl_tail( dl_input + dl_count * DL_UF3_RECORD );
 
-        /* buffer variable */
-        le_byte_t * dl_obuffer( nullptr );
+    # ifdef __SSE2__
 
-        /* parsing variable */
-        le_size_t dl_parse( 0 );
+        /* record tail mask variable */
+        __m128i const dl_lmask( _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0 ) );
 
-        /* parsing variable */
-        le_size_t dl_index( 0 );
+        /* record tail mask variable */
+        __m128i const dl_hmask( _mm_setr_epi8( 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1 ) );
 
-        /* reading variable */
-        le_size_t dl_read( 1 );
+        /* record type variable */
+        __m128i const dl_type( _mm_setr_epi8( 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, LE_UV3_POINT, 0, 0, 0 ) );
 
-        /* stream variable */
-        std::fstream dl_istream;
+        /* record tail variable */
+        __m128i dl_record;
 
-        /* stream variable */
-        std::fstream dl_ostream;
+        /* parsing records */
+        for ( ; dl_input < dl_tail; dl_input += DL_UF3_RECORD, dl_output += LE_ARRAY_DATA ) {
 
-    /* error management */
-    try {
+            /* assign record head */
+            _mm_storeu_si128( ( __m128i * ) dl_output, _mm_loadu_si128( ( __m128i const * ) dl_input ) );
+
+            /* read record tail */
+            dl_record = _mm_loadu_si128( ( __m128i const * ) ( dl_input + DL_UF3_RECORD - 16 ) );
+
+            /* insert primitive type */
+            dl_record = _mm_or_si128( _mm_or_si128( _mm_and_si128( _mm_srli_si128( dl_record, 1 ), dl_lmask ), _mm_and_si128( dl_record, dl_hmask ) ), dl_type );
+
+            /* assign record tail */
+            _mm_storeu_si128( ( __m128i * ) ( dl_output + LE_ARRAY_DATA - 16 ), dl_record );
+
+        }
+
+    # else
+
+        /* parsing records */
+        for ( ; dl_input < dl_tail; dl_input += DL_UF3_RECORD, dl_output += LE_ARRAY_DATA ) {
+
+            /* assign primitive coordinates */
+            std::memcpy( dl_output, dl_input, LE_ARRAY_DATA_POSE );
+
+            /* assign primitive type */
+            dl_output[LE_ARRAY_DATA_POSE] = LE_UV3_POINT;
+
+            /* assign primitive data */
+            std::memcpy( dl_output + LE_ARRAY_DATA_POSE + LE_ARRAY_DATA_TYPE, dl_input + DL_UF3_POSE, LE_ARRAY_DATA_DATA );
+
+        }
+
+    # endif
+
+    }
+
+    le_void_t dl_uf3_convert( char const * const dl_ipath, char const * const dl_opath, dl_buffer_t & dl_buffer, le_size_t const dl_threads ) {
+
+        /* input descriptor variable */
+        int dl_ihandle( -1 );
+
+        /* output descriptor variable */
+        int dl_ohandle( -1 );
+
+        /* input status variable */
+        struct stat dl_status;
+
+        /* input records variable */
+        le_size_t dl_count( 0 );
+
+        /* chunk size variable */
+        le_size_t dl_span( 0 );
+
+        /* chunks variable */
+        le_size_t dl_chunks( 0 );
+
+        /* tasks variable */
+        le_size_t dl_tasks( 0 );
+
+        /* buffer size variable */
+        le_size_t dl_need( 0 );
+
+        /* check paths */
+        if ( ( dl_ipath == nullptr ) || ( dl_opath == nullptr ) ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_ACCESS );
+
+        }
+
+        /* create input descriptor */
+        if ( ( dl_ihandle = open( dl_ipath, O_RDONLY ) ) < 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_READ );
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::binary );
+        }
 
-        /* check input stream */
-        if ( dl_istream.is_open() == false ) {
+        /* retrieve input status */
+        if ( fstat( dl_ihandle, & dl_status ) != 0 ) {
+
+            /* delete input descriptor */
+            close( dl_ihandle );
 
             /* send message */
             throw( LC_ERROR_IO_READ );
 
         }
 
-        /* create output stream */
-        dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
+        /* compute input records */
+        dl_count = dl_status.st_size / DL_UF3_RECORD;
+
+        /* compute chunk size */
+        dl_span = std::max( std::min( dl_count, le_size_t( DL_UF3_CHUNK ) ), le_size_t( 1 ) );
+
+        /* compute chunks */
+        dl_chunks = ( dl_count + dl_span - 1 ) / dl_span;
+
+        /* compute tasks */
+        dl_tasks = std::max( std::min( dl_threads, dl_chunks ), le_size_t( 1 ) );
+
+        /* compute buffer size */
+        dl_need = dl_tasks * dl_span * ( DL_UF3_RECORD + LE_ARRAY_DATA );
+
+        /* check buffer capacity */
+        if ( dl_buffer.bf_size < dl_need ) {
+
+            /* release buffer memory */
+            delete [] dl_buffer.bf_data;
+
+            /* reset buffer capacity */
+            dl_buffer.bf_size = 0;
+
+            /* allocate buffer memory */
+            if ( ( dl_buffer.bf_data = new ( std::nothrow ) le_byte_t[dl_need] ) == nullptr ) {
+
+                /* delete input descriptor */
+                close( dl_ihandle );
+
+                /* send message */
+                throw( LC_ERROR_MEMORY );
+
+            }
+
+            /* assign buffer capacity */
+            dl_buffer.bf_size = dl_need;
+
+        }
+
+        /* create output descriptor */
+        if ( ( dl_ohandle = open( dl_opath, O_WRONLY | O_CREAT | O_TRUNC, 0666 ) ) < 0 ) {
+
+            /* delete input descriptor */
+            close( dl_ihandle );
+
+            /* send message */
+            throw( LC_ERROR_IO_WRITE );
+
+        }
+
+    /* error management */
+    try {
+
+        /* parsing rounds */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_chunks; dl_parse += dl_tasks ) {
+
+            /* round tasks variable */
+            le_size_t dl_round( std::min( dl_tasks, dl_chunks - dl_parse ) );
+
+            /* converting chunks */
+            lc_thread( dl_round, dl_round, [&]( le_size_t const dl_chunk ) {
+
+                /* chunk head variable */
+                le_size_t dl_head( ( dl_parse + dl_chunk ) * dl_span );
+
+                /* chunk size variable */
+                le_size_t dl_size( std::min( dl_count - dl_head, dl_span ) );
+
+                /* chunk input buffer variable */
+                le_byte_t * dl_ibuffer( dl_buffer.bf_data + dl_chunk * dl_span * ( DL_UF3_RECORD + LE_ARRAY_DATA ) );
+
+                /* chunk output buffer variable */
+                le_byte_t * dl_obuffer( dl_ibuffer + dl_span * DL_UF3_RECORD );
+
+                /* read chunk records */
+                if ( dl_uf3_read( dl_ihandle, dl_ibuffer, dl_size * DL_UF3_RECORD, dl_head * DL_UF3_RECORD ) != dl_size * DL_UF3_RECORD ) {
+
+                    /* send message */
+                    throw( LC_ERROR_IO_READ );
+
+                }
+
+                /* repack chunk records */
+                dl_uf3_repack( dl_ibuffer, dl_obuffer, dl_size );
+
+                /* write chunk records */
+                dl_uf3_write( dl_ohandle, dl_obuffer, dl_size * LE_ARRAY_DATA, dl_head * LE_ARRAY_DATA );
+
+            } );
+
+        }
+
+    /* error management */
+    } catch ( int dl_code ) {
+
+        /* delete output descriptor */
+        close( dl_ohandle );
+
+        /* delete input descriptor */
+        close( dl_ihandle );
 
-        /* check output stream */
-        if ( dl_ostream.is_open() == false ) {
+        /* send message */
+        throw( dl_code );
+
+    }
+
+        /* delete input descriptor */
+        close( dl_ihandle );
+
+        /* delete output descriptor */
+        if ( close( dl_ohandle ) != 0 ) {
 
             /* send message */
             throw( LC_ERROR_IO_WRITE );
 
         }
 
-        /* allocate buffer memory */
-        if ( ( dl_ibuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * DL_UF3_RECORD] ) == nullptr ) {
+    }
+
+/*
+    source - batch methods
+ */
+
+    le_void_t dl_uf3_scan( std::string const & dl_input, std::string const & dl_output, std::string const & dl_name, std::vector < dl_file_t > & dl_files ) {
+
+        /* directories variable */
+        std::vector < std::string > dl_directories;
+
+        /* file variable */
+        dl_file_t dl_file;
+
+        /* status variable */
+        struct stat dl_status;
+
+        /* directory variable */
+        DIR * dl_directory( nullptr );
+
+        /* entity variable */
+        struct dirent * dl_entity( nullptr );
+
+        /* prefix variable */
+        std::string dl_prefix( dl_name.empty() ? dl_name : dl_name + "/" );
+
+        /* check consistency */
+        if ( ( dl_directory = opendir( ( dl_input + "/" + dl_name ).c_str() ) ) == nullptr ) {
 
             /* send message */
-            throw( LC_ERROR_MEMORY );
+            throw( LC_ERROR_IO_ACCESS );
+
+        }
+
+        /* entity enumeration */
+        while ( ( dl_entity = readdir( dl_directory ) ) != nullptr ) {
+
+            /* convert string */
+            std::string dl_entry( dl_entity->d_name );
+
+            /* check for directories */
+            if ( dl_entity->d_type == DT_DIR ) {
+
+                /* filter special directories */
+                if ( ( dl_entry == "." ) || ( dl_entry == ".." ) ) continue;
+
+                /* push directory */
+                dl_directories.push_back( dl_prefix + dl_entry );
+
+            } else
+            if ( dl_entity->d_type == DT_REG ) {
+
+                /* filter on extension */
+                if ( ( dl_entry.length() < 4 ) || ( dl_entry.substr( dl_entry.length() - 4, 4 ) != ".uf3" ) ) continue;
+
+                /* retrieve file status */
+                if ( stat( ( dl_input + "/" + dl_prefix + dl_entry ).c_str(), & dl_status ) != 0 ) {
+
+                    /* close directory */
+                    closedir( dl_directory );
+
+                    /* send message */
+                    throw( LC_ERROR_IO_ACCESS );
+
+                }
+
+                /* assign file name */
+                dl_file.fl_name = dl_prefix + dl_entry;
+
+                /* assign file size */
+                dl_file.fl_size = dl_status.st_size;
+
+                /* push file */
+                dl_files.push_back( dl_file );
+
+            }
+
+        }
+
+        /* close directory */
+        closedir( dl_directory );
+
+        /* parsing directories */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_directories.size(); dl_parse ++ ) {
+
+            /* create output directory */
+            if ( ( mkdir( ( dl_output + "/" + dl_directories[dl_parse] ).c_str(), 0777 ) != 0 ) && ( errno != EEXIST ) ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+            /* enumerate directory */
+            dl_uf3_scan( dl_input, dl_output, dl_directories[dl_parse], dl_files );
 
         }
 
-        /* allocate buffer memory */
-        if ( ( dl_obuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
+    }
+
+    le_void_t dl_uf3_list( char const * const dl_list, std::string const & dl_input, std::string const & dl_output, std::vector < dl_file_t > & dl_files ) {
+
+        /* stream variable */
+        std::ifstream dl_stream( dl_list );
+
+        /* line variable */
+        std::string dl_line;
+
+        /* directory variable */
+        std::string dl_last;
+
+        /* file variable */
+        dl_file_t dl_file;
+
+        /* status variable */
+        struct stat dl_status;
+
+        /* check stream */
+        if ( dl_stream.is_open() == false ) {
 
             /* send message */
-            throw( LC_ERROR_MEMORY );
+            throw( LC_ERROR_IO_READ );
 
         }
 
-        /* stream conversion */
-        while ( dl_read != 0 ) {
+        /* parsing list */
+        while ( std::getline( dl_stream, dl_line ) ) {
 
-            /* read stream chunk */
-            dl_istream.read( ( char * ) dl_ibuffer, LE_UV3_CHUNK * DL_UF3_RECORD );
+            /* check line */
+            if ( dl_line.empty() == true ) continue;
 
-            /* check stream reading */
-            if ( ( dl_read = dl_istream.gcount() ) > 0 ) {
+            /* retrieve file status */
+            if ( stat( ( dl_input + "/" + dl_line ).c_str(), & dl_status ) != 0 ) {
 
-                /* reset index */
-                dl_parse = 0, dl_index = 0;
+                /* send message */
+                throw( LC_ERROR_IO_ACCESS );
 
-                /* parsing stream chunk */
-                while ( dl_parse < dl_read ) {
+            }
+
+            /* directory variable */
+            std::string dl_directory( dl_line.substr( 0, dl_line.find_last_of( '/' ) == std::string::npos ? 0 : dl_line.find_last_of( '/' ) ) );
 
-                    /* assign primitive coordinates */
-                    std::memcpy( dl_obuffer + dl_index, dl_ibuffer + dl_parse, LE_ARRAY_DATA_POSE );
+            /* check directory */
+            if ( dl_directory != dl_last ) {
 
-                    /* update index */
-                    dl_parse += DL_UF3_POSE, dl_index += LE_ARRAY_DATA_POSE;
+                /* parsing directory components */
+                for ( le_size_t dl_parse( 1 ); dl_parse <= dl_directory.length(); dl_parse ++ ) {
 
-                    /* assign primitive type */
-                    ( * ( dl_obuffer + dl_index ) ) = LE_UV3_POINT;
+                    /* detect component end */
+                    if ( ( dl_parse < dl_directory.length() ) && ( dl_directory[dl_parse] != '/' ) ) continue;
 
-                    /* update index */
-                    dl_index += LE_ARRAY_DATA_TYPE;
+                    /* create output directory */
+                    if ( ( mkdir( ( dl_output + "/" + dl_directory.substr( 0, dl_parse ) ).c_str(), 0777 ) != 0 ) && ( errno != EEXIST ) ) {
 
-                    /* assign primitive data */
-                    std::memcpy( dl_obuffer + dl_index, dl_ibuffer + dl_parse, LE_ARRAY_DATA_DATA );
+                        /* send message */
+                        throw( LC_ERROR_IO_WRITE );
 
-                    /* update index */
-                    dl_parse += DL_UF3_DATA, dl_index += LE_ARRAY_DATA_DATA;
+                    }
 
                 }
 
-                /* export converted records */
-                dl_ostream.write( ( char * ) dl_obuffer, ( dl_read / DL_UF3_RECORD ) * LE_ARRAY_DATA );
+                /* update directory */
+                dl_last = dl_directory;
 
             }
 
+            /* assign file name */
+            dl_file.fl_name = dl_line;
+
+            /* assign file size */
+            dl_file.fl_size = dl_status.st_size;
+
+            /* push file */
+            dl_files.push_back( dl_file );
+
         }
 
-        /* release buffer memory */
-        delete [] dl_obuffer;
+    }
 
-        /* release buffer memory */
-        delete [] dl_ibuffer;
+    le_void_t dl_uf3_batch( char const * const dl_input, char const * const dl_output, char const * const dl_list, le_size_t const dl_threads, le_size_t const dl_jobs ) {
+
+        /* files variable */
+        std::vector < dl_file_t > dl_files;
+
+        /* buffers variable */
+        std::vector < dl_buffer_t > dl_buffers;
+
+        /* buffers mutex variable */
+        std::mutex dl_mutex;
+
+        /* progress variable */
+        le_size_t dl_done( 0 );
+
+        /* progress variable */
+        le_size_t dl_skip( 0 );
+
+        /* progress variable */
+        le_size_t dl_bytes( 0 );
+
+        /* string conversion */
+        std::string dl_inbase( dl_input );
 
-        /* delete output stream */
-        dl_ostream.close();
+        /* string conversion */
+        std::string dl_outbase( dl_output );
 
-        /* delete input stream */
-        dl_istream.close();
+        /* file threads variable */
+        le_size_t dl_share( std::max( dl_threads / dl_jobs, le_size_t( 1 ) ) );
+
+        /* timing variable */
+        std::chrono::steady_clock::time_point dl_start( std::chrono::steady_clock::now() );
+
+        /* check files list */
+        if ( dl_list == nullptr ) {
+
+            /* enumerate input tree */
+            dl_uf3_scan( dl_inbase, dl_outbase, "", dl_files );
+
+        } else {
+
+            /* read files list */
+            dl_uf3_list( dl_list, dl_inbase, dl_outbase, dl_files );
+
+        }
+
+        /* sort files by decreasing size */
+        std::sort( dl_files.begin(), dl_files.end(), [] ( dl_file_t const & dl_a, dl_file_t const & dl_b ) {
+
+            /* compare sizes */
+            return( dl_a.fl_size > dl_b.fl_size );
+
+        } );
+
+    /* error management */
+    try {
+
+        /* processing files */
+        lc_thread( dl_files.size(), dl_jobs, [ & ] ( le_size_t const dl_index ) {
+
+            /* file variable */
+            dl_file_t const & dl_file( dl_files[dl_index] );
+
+            /* output name variable */
+            std::string dl_name( dl_file.fl_name );
+
+            /* buffer variable */
+            dl_buffer_t dl_buffer = { nullptr, 0 };
+
+            /* status variable */
+            struct stat dl_status;
+
+            /* conversion variable */
+            bool dl_convert( true );
+
+            /* check extension */
+            if ( ( dl_name.length() >= 4 ) && ( dl_name.substr( dl_name.length() - 4, 4 ) == ".uf3" ) ) {
+
+                /* remove extension */
+                dl_name.resize( dl_name.length() - 4 );
+
+            }
+
+            /* compose output path */
+            dl_name = dl_outbase + "/" + dl_name + ".uv3";
+
+            /* check output status */
+            if ( stat( dl_name.c_str(), & dl_status ) == 0 ) {
+
+                /* check output size */
+                dl_convert = ( le_size_t( dl_status.st_size ) != ( dl_file.fl_size / DL_UF3_RECORD ) * LE_ARRAY_DATA );
+
+            }
+
+            /* check conversion */
+            if ( dl_convert == true ) {
+
+                /* lock buffers */
+                dl_mutex.lock();
+
+                /* check available buffer */
+                if ( dl_buffers.empty() == false ) {
+
+                    /* retrieve buffer */
+                    dl_buffer = dl_buffers.back();
+
+                    /* remove buffer */
+                    dl_buffers.pop_back();
+
+                }
+
+                /* unlock buffers */
+                dl_mutex.unlock();
+
+            /* error management */
+            try {
+
+                /* convert file in temporary file */
+                dl_uf3_convert( ( dl_inbase + "/" + dl_file.fl_name ).c_str(), ( dl_name + ".part" ).c_str(), dl_buffer, dl_share );
+
+            /* error management */
+            } catch ( int dl_code ) {
+
+                /* lock buffers */
+                std::lock_guard < std::mutex > dl_lock( dl_mutex );
+
+                /* release buffer */
+                dl_buffers.push_back( dl_buffer );
+
+                /* send message */
+                throw( dl_code );
+
+            }
+
+                /* lock buffers */
+                dl_mutex.lock();
+
+                /* release buffer */
+                dl_buffers.push_back( dl_buffer );
+
+                /* unlock buffers */
+                dl_mutex.unlock();
+
+                /* validate output file */
+                if ( std::rename( ( dl_name + ".part" ).c_str(), dl_name.c_str() ) != 0 ) {
+
+                    /* send message */
+                    throw( LC_ERROR_IO_WRITE );
+
+                }
+
+            }
+
+            /* lock progress */
+            std::lock_guard < std::mutex > dl_lock( dl_mutex );
+
+            /* check conversion */
+            if ( dl_convert == true ) {
+
+                /* update progress */
+                dl_bytes += dl_file.fl_size;
+
+            } else {
+
+                /* update progress */
+                dl_skip ++;
+
+            }
+
+            /* display progress */
+            dl_uf3_progress( ++ dl_done, dl_skip, dl_files.size(), dl_bytes, dl_start );
+
+        } );
+
+    /* error management */
+    } catch ( int dl_code ) {
+
+        /* parsing buffers */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_buffers.size(); dl_parse ++ ) {
+
+            /* release buffer memory */
+            delete [] dl_buffers[dl_parse].bf_data;
+
+        }
+
+        /* send message */
+        throw( dl_code );
+
+    }
+
+        /* parsing buffers */
+        for ( le_size_t dl_parse( 0 ); dl_parse < dl_buffers.size(); dl_parse ++ ) {
+
+            /* release buffer memory */
+            delete [] dl_buffers[dl_parse].bf_data;
+
+        }
+
+        /* check progress */
+        if ( dl_done > 0 ) {
+
+            /* terminate progress */
+            std::cerr << std::endl;
+
+        }
+
+    }
+
+/*
+    source - progress methods
+ */
+
+    le_void_t dl_uf3_progress( le_size_t const dl_done, le_size_t const dl_skip, le_size_t const dl_count, le_size_t const dl_bytes, std::chrono::steady_clock::time_point const & dl_start ) {
+
+        /* elapsed time variable */
+        le_real_t dl_time( std::chrono::duration < le_real_t > ( std::chrono::steady_clock::now() - dl_start ).count() );
+
+        /* megabytes variable */
+        le_real_t dl_mega( le_real_t( dl_bytes ) / 1048576.0 );
+
+        /* display progress */
+        std::cerr << "\rdalai-uf3-uv3 : " << dl_done << "/" << dl_count << " files, " << dl_skip << " skipped, " << std::fixed << std::setprecision( 1 ) << dl_mega << " MB, " << ( dl_time > 0.0 ? dl_mega / dl_time : 0.0 ) << " MB/s" << std::flush;
+
+    }
+
+/*
+    source - i/o methods
+ */
+
+    le_size_t dl_uf3_read( int const dl_handle, le_byte_t * const dl_buffer, le_size_t const dl_size, le_size_t const dl_offset ) {
+
+        /* reading variable */
+        le_size_t dl_read( 0 );
+
+        /* reading variable */
+        ssize_t dl_count( 0 );
+
+        /* reading buffer */
+        while ( dl_read < dl_size ) {
+
+            /* read buffer part */
+            if ( ( dl_count = pread( dl_handle, dl_buffer + dl_read, dl_size - dl_read, dl_offset + dl_read ) ) <= 0 ) {
+
+                /* check interruption */
+                if ( ( dl_count < 0 ) && ( errno == EINTR ) ) continue;
+
+                /* check end of file */
+                if ( dl_count == 0 ) break;
+
+                /* send message */
+                throw( LC_ERROR_IO_READ );
+
+            }
+
+            /* update reading */
+            dl_read += dl_count;
+
+        }
+
+        /* return read size */
+        return( dl_read );
+
+    }
+
+    le_void_t dl_uf3_write( int const dl_handle, le_byte_t const * const dl_buffer, le_size_t const dl_size, le_size_t const dl_offset ) {
+
+        /* writing variable */
+        le_size_t dl_write( 0 );
+
+        /* writing variable */
+        ssize_t dl_count( 0 );
+
+        /* writing buffer */
+        while ( dl_write < dl_size ) {
+
+            /* write buffer part */
+            if ( ( dl_count = pwrite( dl_handle, dl_buffer + dl_write, dl_size - dl_write, dl_offset + dl_write ) ) <= 0 ) {
+
+                /* check interruption */
+                if ( ( dl_count < 0 ) && ( errno == EINTR ) ) continue;
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+            /* update writing */
+            dl_write += dl_count;
+
+        }
+
+    }
+
+/*
+    source - main methods
+ */
+
+    int main( int argc, char ** argv ) {
+
+        /* i/o path variable */
+        char * dl_input( lc_read_string( argc, argv, "--input", "-i" ) );
+
+        /* i/o path variable */
+        char * dl_output( lc_read_string( argc, argv, "--output", "-o" ) );
+
+        /* threads variable */
+        le_size_t dl_threads( lc_thread_count( lc_read_unsigned( argc, argv, "--threads", "-n", 0 ) ) );
+
+        /* jobs variable */
+        le_size_t dl_jobs( lc_thread_count( lc_read_unsigned( argc, argv, "--jobs", "-j", 0 ) ) );
+
+        /* buffer variable */
+        dl_buffer_t dl_buffer = { nullptr, 0 };
+
+    /* error management */
+    try {
+
+        /* check paths */
+        if ( ( dl_input == nullptr ) || ( dl_output == nullptr ) ) {
+
+            /* send message */
+            throw( LC_ERROR_IO_ACCESS );
+
+        }
+
+        /* check execution mode */
+        if ( lc_file_detect( dl_input ) == LC_DIRECTORY ) {
+
+            /* check consistency */
+            if ( lc_file_detect( dl_output ) != LC_DIRECTORY ) {
+
+                /* send message */
+                throw( LC_ERROR_IO_WRITE );
+
+            }
+
+            /* batch processing */
+            dl_uf3_batch( dl_input, dl_output, lc_read_string( argc, argv, "--list", "-l" ), dl_threads, dl_jobs );
+
+        } else {
+
+            /* convert file */
+            dl_uf3_convert( dl_input, dl_output, dl_buffer, dl_threads );
+
+            /* release buffer memory */
+            delete [] dl_buffer.bf_data;
+
+        }
 
     /* error management */
     } catch ( int dl_code ) {
 
+        /* release buffer memory */
+        delete [] dl_buffer.bf_data;
+
         /* error management */
         lc_error( dl_code );
 
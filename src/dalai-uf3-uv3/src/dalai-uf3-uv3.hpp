@@ -54,6 +54,22 @@
 
     # include <iostream>
     # include <fstream>
+    # include <iomanip>
+    # include <cstdio>
+    # include <cerrno>
+    # include <string>
+    # include <vector>
+    # include <algorithm>
+    # include <mutex>
+    # include <chrono>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <dirent.h>
+    # include <sys/types.h>
+    # include <sys/stat.h>
+    # ifdef __SSE2__
+    # include <emmintrin.h>
+    # endif
     # include <common-include.hpp>
     # include <eratosthene-include.h>
 
@@ -68,6 +84,9 @@
     /* define uf3 record */
     # define DL_UF3_RECORD ( DL_UF3_POSE + DL_UF3_DATA )
 
+    /* define conversion chunk - records */
+    # define DL_UF3_CHUNK  ( 262144 )
+
 /*
     header - preprocessor macros
  */
@@ -80,22 +99,218 @@
     header - structures
  */
 
+    /*! \struct dl_file_t
+     *  \brief batch file structure
+     *
+     *  This structure holds the description of an uf3 file waiting to be
+     *  converted in batch mode.
+     *
+     *  \var dl_file_t::fl_name
+     *  File name, relative to the input directory
+     *  \var dl_file_t::fl_size
+     *  File size, in bytes
+     */
+
+    struct dl_file_t {
+
+        std::string fl_name;
+        le_size_t   fl_size;
+
+    };
+
+    /*! \struct dl_buffer_t
+     *  \brief conversion buffer structure
+     *
+     *  This structure holds a conversion buffer and its capacity. The buffer
+     *  is grown by the conversion function as the converted files require it
+     *  and can then be reused from one file to the next.
+     *
+     *  \var dl_buffer_t::bf_data
+     *  Buffer memory, null pointer until allocated
+     *  \var dl_buffer_t::bf_size
+     *  Buffer capacity, in bytes
+     */
+
+    struct dl_buffer_t {
+
+        le_byte_t * bf_data;
+        le_size_t   bf_size;
+
+    };
+
 /*
     header - function prototypes
  */
 
+    /*! \brief conversion methods
+     *
+     *  This function repacks the provided amount of uf3 records into uv3 point
+     *  records. The position of each record is copied as is and the point type
+     *  is inserted before its color components.
+     *
+     *  When SSE2 is available, each record is moved through two overlapping
+     *  16-bytes registers : the first one carries the beginning of the record
+     *  and the second one carries its end, shifted by one byte to make room
+     *  for the type. The loads and stores never exceed the records ranges.
+     *  Otherwise, the records are repacked through byte copies.
+     *
+     *  \param dl_input  uf3 records buffer
+     *  \param dl_output uv3 records buffer
+     *  \param dl_count  Amount of records
+     */
+
+    le_void_t dl_uf3_repack( le_byte_t const * dl_input, le_byte_t * dl_output, le_size_t const dl_count );
+
+    /*! \brief conversion methods
+     *
+     *  This function converts the provided uf3 file into the provided uv3 file.
+     *
+     *  The input file is split in chunks of records that are converted in
+     *  parallel by rounds of one chunk per thread. Each thread reads its chunk
+     *  at its offset, repacks it and writes the uv3 records at their offset in
+     *  the output file, the positions of the chunks being known in advance.
+     *  The incomplete record that could end the input file is ignored. Each
+     *  round only starts as many threads as there are remaining chunks.
+     *
+     *  The provided buffer has to hold, for each thread, a chunk of uf3
+     *  records followed by a chunk of uv3 records. It is grown, if required,
+     *  according to the amount of chunks of the file, so that small files only
+     *  need small buffers. It is provided by the caller, who has to release
+     *  its memory, so that it can be reused for the conversion of many files.
+     *
+     *  \param dl_ipath   uf3 file path
+     *  \param dl_opath   uv3 file path
+     *  \param dl_buffer  Conversion buffer
+     *  \param dl_threads Amount of threads
+     */
+
+    le_void_t dl_uf3_convert( char const * const dl_ipath, char const * const dl_opath, dl_buffer_t & dl_buffer, le_size_t const dl_threads );
+
+    /*! \brief batch methods
+     *
+     *  This function enumerates the uf3 files of the provided directory of the
+     *  input tree, relative to the input tree root, and pushes them in the
+     *  provided files array. The sub-directories are enumerated recursively and
+     *  created in the output tree as they are encountered.
+     *
+     *  \param dl_input  Input tree root
+     *  \param dl_output Output tree root
+     *  \param dl_name   Enumerated directory, relative to the roots
+     *  \param dl_files  Files array
+     */
+
+    le_void_t dl_uf3_scan( std::string const & dl_input, std::string const & dl_output, std::string const & dl_name, std::vector < dl_file_t > & dl_files );
+
+    /*! \brief batch methods
+     *
+     *  This function reads the provided list of uf3 files, one path per line,
+     *  relative to the input tree root, and pushes them in the provided files
+     *  array. The directories holding the listed files are created in the
+     *  output tree.
+     *
+     *  \param dl_list   Files list path
+     *  \param dl_input  Input tree root
+     *  \param dl_output Output tree root
+     *  \param dl_files  Files array
+     */
+
+    le_void_t dl_uf3_list( char const * const dl_list, std::string const & dl_input, std::string const & dl_output, std::vector < dl_file_t > & dl_files );
+
+    /*! \brief batch methods
+     *
+     *  This function converts the uf3 files of the provided input tree into the
+     *  provided output tree, keeping their relative paths and replacing their
+     *  extension by the uv3 one. If a list is provided, only the listed files
+     *  are converted, otherwise the whole input tree is converted.
+     *
+     *  The files are sorted by decreasing size and distributed over the
+     *  provided number of jobs, converting files concurrently. The provided
+     *  number of threads is shared between the jobs for the conversion of each
+     *  file. Each job reuses its conversion buffer for all the files it
+     *  converts, the buffer being only grown when a file requires it.
+     *
+     *  The files whose output already exists with the expected size are
+     *  skipped. As each file is converted in a temporary file renamed at the
+     *  end of its conversion, an interrupted batch can then be resumed without
+     *  converting again the already converted files. The progress and
+     *  throughput are reported on the error stream as the files are converted.
+     *
+     *  \param dl_input   Input tree root
+     *  \param dl_output  Output tree root
+     *  \param dl_list    Files list path, null pointer for the whole tree
+     *  \param dl_threads Number of threads
+     *  \param dl_jobs    Number of concurrent files
+     */
+
+    le_void_t dl_uf3_batch( char const * const dl_input, char const * const dl_output, char const * const dl_list, le_size_t const dl_threads, le_size_t const dl_jobs );
+
+    /*! \brief progress methods
+     *
+     *  This function displays, on the error stream, the progress of the batch
+     *  conversion. The number of processed and skipped files and the number of
+     *  converted bytes are displayed with the throughput computed since the
+     *  provided starting time.
+     *
+     *  \param dl_done  Number of processed files
+     *  \param dl_skip  Number of skipped files
+     *  \param dl_count Number of files
+     *  \param dl_bytes Number of converted bytes
+     *  \param dl_start Batch starting time
+     */
+
+    le_void_t dl_uf3_progress( le_size_t const dl_done, le_size_t const dl_skip, le_size_t const dl_count, le_size_t const dl_bytes, std::chrono::steady_clock::time_point const & dl_start );
+
+    /*! \brief i/o methods
+     *
+     *  This function reads the provided amount of bytes from the descriptor at
+     *  the provided offset. The reading stops earlier only at the end of the
+     *  file.
+     *
+     *  \param dl_handle Input descriptor
+     *  \param dl_buffer Reading buffer
+     *  \param dl_size   Amount of bytes to read
+     *  \param dl_offset Reading offset, in bytes
+     *
+     *  \return Returns the amount of read bytes
+     */
+
+    le_size_t dl_uf3_read( int const dl_handle, le_byte_t * const dl_buffer, le_size_t const dl_size, le_size_t const dl_offset );
+
+    /*! \brief i/o methods
+     *
+     *  This function writes the provided amount of bytes in the descriptor at
+     *  the provided offset.
+     *
+     *  \param dl_handle Output descriptor
+     *  \param dl_buffer Writing buffer
+     *  \param dl_size   Amount of bytes to write
+     *  \param dl_offset Writing offset, in bytes
+     */
+
+    le_void_t dl_uf3_write( int const dl_handle, le_byte_t const * const dl_buffer, le_size_t const dl_size, le_size_t const dl_offset );
+
     /*! \brief main function
      *
      *  The main function reads the provided uf3 file and converts it into an
      *  uv3 stream :
      *
-     *      ./dalai-uf3-uv3 --input/-i [uf3 input file]
-     *                      --output/-o [uv3 output file]
+     *      ./dalai-uf3-uv3 --input/-i [uf3 input file or directory]
+     *                      --output/-o [uv3 output file or directory]
+     *                      --list/-l [uf3 files list]
+     *                      --threads/-n [amount of threads]
+     *                      --jobs/-j [number of concurrent files]
+     *
+     *  The main function reads the parameters and starts the conversion. The
+     *  input file is read by chunks and each chunk is converted from uf3 to
+     *  uv3 format. The converted chunks are then exported in the output file.
+     *  The chunks are converted in parallel, all the host threads being used
+     *  by default.
      *
-     *  The main function starts by creating the two input and output streams
-     *  before to start the conversion. The input file is read by chunks and
-     *  each chunk is converted from uf3 to uv3 format. The converted chunks are
-     *  then exported in the output file.
+     *  If the input directive points to a directory, the output directive has
+     *  to point to another directory and the uf3 files of the input tree, or
+     *  only the ones of the provided list, are converted in batch mode. The
+     *  files are converted concurrently by the specified number of jobs, the
+     *  number of hardware threads being used by default.
      *
      *  This software is design to ensure compatibility with the previous uf3
      *  format used by the dalai-suite.
@@ -25,99 +25,45 @@
     source - header methods
  */
 
-    le_void_t dl_uv3_ply_header( std::fstream & dl_stream, le_size_t const dl_vertex, le_size_t const dl_face ) {
+    le_void_t dl_uv3_ply_header( std::ostream & dl_stream, le_size_t const dl_vertex, le_size_t const dl_face ) {
 
-        /* export header */
-        dl_stream << "ply" << std::endl;
-        dl_stream << "format binary_little_endian 1.0" << std::endl;
-        dl_stream << "element vertex " << dl_vertex << std::endl;
-        dl_stream << "property float x" << std::endl;
-        dl_stream << "property float y" << std::endl;
-        dl_stream << "property float z" << std::endl;
-        dl_stream << "property uchar red" << std::endl;
-        dl_stream << "property uchar green" << std::endl;
-        dl_stream << "property uchar blue" << std::endl;
-
-        /* check primitive */
-        if ( dl_face != 0 ) {
-
-            /* export header */
-            dl_stream << "element face " << dl_face << std::endl;
-            dl_stream << "property list uchar int vertex_indices" << std::endl;
-
-        }
-
-        /* export header */
-        dl_stream << "end_header" << std::endl;
-
-    }
-
-/*
-    source - statistical methods
- */
-
-    le_size_t dl_uv3_ply_primitive( std::fstream & dl_stream ) {
-
-        /* buffer variable */
-        le_byte_t * dl_buffer( nullptr );
+        /* header variable */
+        std::ostringstream dl_header;
 
-        /* reading variable */
-        le_size_t dl_read( 1 );
-
-        /* count variable */
-        le_size_t dl_lcount( 0 );
+        /* padding variable */
+        le_size_t dl_padding( 0 );
 
-        /* count variable */
-        le_size_t dl_tcount( 0 );
+        /* compose header */
+        dl_header << "ply" << std::endl;
+        dl_header << "format binary_little_endian 1.0" << std::endl;
+        dl_header << "element vertex " << dl_vertex << std::endl;
+        dl_header << "property float x" << std::endl;
+        dl_header << "property float y" << std::endl;
+        dl_header << "property float z" << std::endl;
+        dl_header << "property uchar red" << std::endl;
+        dl_header << "property uchar green" << std::endl;
+        dl_header << "property uchar blue" << std::endl;
 
-        /* allocate buffer memory */
-        if ( ( dl_buffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
+        /* check primitive */
+        if ( dl_face != 0 ) {
 
-            /* send message */
-            throw( LC_ERROR_MEMORY );
+            /* compose header */
+            dl_header << "element face " << dl_face << std::endl;
+            dl_header << "property list uchar int vertex_indices" << std::endl;
 
         }
 
-        /* clear stream state */
-        dl_stream.clear();
-
-        /* begining of stream */
-        dl_stream.seekg( 0, std::ios::beg );
-
-        /* primitive analysis */
-        while ( dl_read != 0 ) {
-
-            /* read stream chunk */
-            dl_stream.read( ( char * ) dl_buffer, LE_UV3_CHUNK * LE_ARRAY_DATA );
-
-            /* read byte count */
-            dl_read = dl_stream.gcount();
-
-            /* parsing read chunk */
-            for ( le_size_t dl_parse( LE_ARRAY_DATA_POSE ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA ) {
-
-                /* check primitive type */
-                if ( dl_buffer[dl_parse] == LE_UV3_LINE ) {
-
-                    /* update primitive count */
-                    dl_lcount ++;
-
-                } else if ( dl_buffer[dl_parse] == LE_UV3_TRIANGLE ) {
-
-                    /* update primitive count */
-                    dl_tcount ++;
+        /* compute padding length */
+        dl_padding = DL_PLY_HEADER - dl_header.str().size() - std::strlen( "comment\nend_header\n" );
 
-                }
-
-            }
+        /* compose padding comment */
+        dl_header << "comment" << std::string( dl_padding, ' ' ) << std::endl;
 
-        }
-
-        /* release buffer memory */
-        delete [] dl_buffer;
+        /* compose header */
+        dl_header << "end_header" << std::endl;
 
-        /* return primitive count */
-        return( ( dl_lcount / 2 ) + ( dl_tcount / 3 ) );
+        /* export header */
+        dl_stream << dl_header.str();
 
     }
 
@@ -125,7 +71,7 @@
     source - conversion methods
  */
 
-    le_void_t dl_uv3_ply_vertex( std::fstream & dl_istream, std::fstream & dl_ostream ) {
+    le_size_t dl_uv3_ply_convert( lc_uv3_t & dl_istream, std::ostream & dl_ostream, std::ostream * const dl_fstream, le_size_t & dl_vertex ) {
 
         /* buffer variable */
         le_byte_t * dl_ibuffer( nullptr );
@@ -133,8 +79,21 @@
         /* buffer variable */
         le_byte_t * dl_obuffer( nullptr );
 
+        /* buffer variable */
+        le_byte_t dl_lbuffer[DL_PLY_LINE];
+
+        /* buffer variable */
+        le_byte_t dl_tbuffer[DL_PLY_FACE];
+
+        /* primitive module variable */
+        le_size_t dl_lmodule( 0 );
+        le_size_t dl_tmodule( 0 );
+
+        /* primitive count variable */
+        le_size_t dl_face( 0 );
+
         /* reading variable */
-        le_size_t dl_read( 1 );
+        le_size_t dl_read( 0 );
 
         /* pointer variable */
         le_real_t * dl_uv3p( nullptr );
@@ -144,14 +103,6 @@
         float   * dl_plyp( nullptr );
         uint8_t * dl_plyd( nullptr );
 
-        /* allocate buffer memory */
-        if ( ( dl_ibuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
-
-            /* send message */
-            throw( LC_ERROR_MEMORY );
-
-        }
-
         /* allocate buffer memory */
         if ( ( dl_obuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * DL_PLY_VERTEX] ) == nullptr ) {
 
@@ -160,23 +111,18 @@
 
         }
 
-        /* clear stream state */
-        dl_istream.clear();
+        /* initialise primitive buffer */
+        ( * dl_lbuffer ) = 2;
+        ( * dl_tbuffer ) = 3;
 
-        /* stream offset */
-        dl_istream.seekg( 0, std::ios::beg );
+        /* initialise vertex count */
+        dl_vertex = 0;
 
         /* parse stream */
-        while ( dl_read != 0 ) {
-
-            /* read stream chunk */
-            dl_istream.read( ( char * ) dl_ibuffer, LE_UV3_CHUNK * LE_ARRAY_DATA );
-
-            /* read byte count */
-            dl_read = dl_istream.gcount();
+        while ( ( dl_read = dl_istream.uv_get_chunk( & dl_ibuffer ) ) > 0 ) {
 
             /* parsing read chunk */
-            for ( le_size_t dl_parse( 0 ), dl_index( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA, dl_index += DL_PLY_VERTEX ) {
+            for ( le_size_t dl_parse( 0 ), dl_index( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA, dl_index += DL_PLY_VERTEX, dl_vertex ++ ) {
 
                 /* compute buffer pointer */
                 dl_uv3p = ( le_real_t * ) ( dl_ibuffer + dl_parse );
@@ -200,83 +146,14 @@
                 dl_plyd[1] = dl_uv3d[2];
                 dl_plyd[2] = dl_uv3d[3];
 
-            }
-
-            /* export buffer */
-            dl_ostream.write( ( char * ) dl_obuffer, ( dl_read / LE_ARRAY_DATA ) * DL_PLY_VERTEX );
-
-        }
-
-        /* release buffer memory */
-        delete [] dl_obuffer;
-
-        /* release buffer memory */
-        delete [] dl_ibuffer;
-
-    }
-
-    le_void_t dl_uv3_ply_face( std::fstream & dl_istream, std::fstream & dl_ostream ) {
-
-        /* buffer variable */
-        le_byte_t * dl_ibuffer( nullptr );
-
-        /* buffer variable */
-        le_byte_t dl_lbuffer[DL_PLY_LINE];
-
-        /* buffer variable */
-        le_byte_t dl_tbuffer[DL_PLY_FACE];
-
-        /* primitive module variable */
-        le_size_t dl_lmodule( 0 );
-        le_size_t dl_tmodule( 0 );
-
-        /* reading variable */
-        le_size_t dl_read( 1 );
-
-        /* offset variable */
-        le_size_t dl_offset( 0 );
-
-        /* buffer pointer variable */
-        le_data_t * dl_uv3d( nullptr );
-
-        /* allocate buffer memory */
-        if ( ( dl_ibuffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * LE_ARRAY_DATA] ) == nullptr ) {
-
-            /* send message */
-            throw( LC_ERROR_MEMORY );
-
-        }
-
-        /* clear stream state */
-        dl_istream.clear();
-
-        /* stream offset */
-        dl_istream.seekg( 0, std::ios::beg );
-
-        /* initialise primitive buffer */
-        ( * dl_lbuffer ) = 2;
-        ( * dl_tbuffer ) = 3;
-
-        /* parse input stream */
-        while ( dl_read != 0 ) {
-
-            /* read stream chunk */
-            dl_istream.read( ( char * ) dl_ibuffer, LE_UV3_CHUNK * LE_ARRAY_DATA );
-
-            /* retrieve byte count */
-            dl_read = dl_istream.gcount();
-
-            /* parsing stream chunk */
-            for ( le_size_t dl_parse( 0 ); dl_parse < dl_read; dl_parse += LE_ARRAY_DATA ) {
-
-                /* compute buffer pointer */
-                dl_uv3d = ( le_data_t * ) ( dl_ibuffer + dl_parse + LE_ARRAY_DATA_POSE );
+                /* check face stream */
+                if ( dl_fstream == nullptr ) continue;
 
                 /* check primitive type */
-                if ( ( * dl_uv3d ) == LE_UV3_LINE ) {
+                if ( dl_uv3d[0] == LE_UV3_LINE ) {
 
                     /* assign vertex index */
-                    ( ( int32_t * ) ( dl_lbuffer + 1 ) )[dl_lmodule] = dl_offset + ( dl_parse / LE_ARRAY_DATA );
+                    ( ( int32_t * ) ( dl_lbuffer + 1 ) )[dl_lmodule] = dl_vertex;
 
                     /* update primitive module */
                     if ( ( ++ dl_lmodule ) == 2 ) {
@@ -285,14 +162,17 @@
                         dl_lmodule = 0;
 
                         /* export buffer */
-                        dl_ostream.write( ( char * ) dl_lbuffer, DL_PLY_LINE );
+                        dl_fstream->write( ( char * ) dl_lbuffer, DL_PLY_LINE );
+
+                        /* update primitive count */
+                        dl_face ++;
 
                     }
 
-                } else if ( ( * dl_uv3d ) == LE_UV3_TRIANGLE ) {
+                } else if ( dl_uv3d[0] == LE_UV3_TRIANGLE ) {
 
                     /* assign vertex index */
-                    ( ( int32_t * ) ( dl_tbuffer + 1 ) )[dl_tmodule] = dl_offset + ( dl_parse / LE_ARRAY_DATA );
+                    ( ( int32_t * ) ( dl_tbuffer + 1 ) )[dl_tmodule] = dl_vertex;
 
                     /* update primitive module */
                     if ( ( ++ dl_tmodule ) == 3 ) {
@@ -301,7 +181,10 @@
                         dl_tmodule = 0;
 
                         /* export buffer */
-                        dl_ostream.write( ( char * ) dl_tbuffer, DL_PLY_FACE );
+                        dl_fstream->write( ( char * ) dl_tbuffer, DL_PLY_FACE );
+
+                        /* update primitive count */
+                        dl_face ++;
 
                     }
 
@@ -309,13 +192,45 @@
 
             }
 
-            /* update offset */
-            dl_offset += ( dl_read / LE_ARRAY_DATA );
+            /* export buffer */
+            dl_ostream.write( ( char * ) dl_obuffer, ( dl_read / LE_ARRAY_DATA ) * DL_PLY_VERTEX );
+
+        }
+
+        /* release buffer memory */
+        delete [] dl_obuffer;
+
+        /* send primitive count */
+        return( dl_face );
+
+    }
+
+    le_void_t dl_uv3_ply_spill( std::istream & dl_fstream, std::ostream & dl_ostream ) {
+
+        /* buffer variable */
+        le_byte_t * dl_buffer( nullptr );
+
+        /* allocate buffer memory */
+        if ( ( dl_buffer = new ( std::nothrow ) le_byte_t[LE_UV3_CHUNK * DL_PLY_FACE] ) == nullptr ) {
+
+            /* send message */
+            throw( LC_ERROR_MEMORY );
+
+        }
+
+        /* rewind face stream */
+        dl_fstream.seekg( 0 );
+
+        /* copy face stream */
+        while ( dl_fstream.read( ( char * ) dl_buffer, LE_UV3_CHUNK * DL_PLY_FACE ).gcount() > 0 ) {
+
+            /* export buffer */
+            dl_ostream.write( ( char * ) dl_buffer, dl_fstream.gcount() );
 
         }
 
         /* release buffer memory */
-        delete [] dl_ibuffer;
+        delete [] dl_buffer;
 
     }
 
@@ -325,39 +240,32 @@
 
     int main( int argc, char ** argv ) {
 
-        /* stream variable */
-        std::fstream dl_istream;
+        /* temporary path variable */
+        le_char_t dl_path[_LE_USE_PATH];
+
+        /* face path variable */
+        std::string dl_spill;
 
         /* stream variable */
         std::fstream dl_ostream;
 
+        /* stream variable */
+        std::fstream dl_fstream;
+
         /* primitive variable */
         le_size_t dl_vertex( 0 );
 
         /* primitive variable */
         le_size_t dl_face( 0 );
 
+        /* conversion mode variable */
+        bool dl_mode( lc_read_flag( argc, argv, "--vertex-only", "-v" ) );
+
     /* error management */
     try {
 
-        /* create input stream */
-        dl_istream.open( lc_read_string( argc, argv, "--input", "-i" ), std::ios::in | std::ios::ate | std::ios::binary );
-
-        /* check input stream */
-        if ( dl_istream.is_open() == false ) {
-
-            /* send message */
-            throw( LC_ERROR_IO_READ );
-
-        }
-
-        /* check consistency */
-        if ( ( dl_vertex = ( dl_istream.tellg() / LE_ARRAY_DATA ) ) == 0 ) {
-
-            /* send message */
-            throw( LC_ERROR_FORMAT );
-
-        }
+        /* create input stream reader */
+        lc_uv3_t dl_istream( lc_read_string( argc, argv, "--input", "-i" ) );
 
         /* create output stream */
         dl_ostream.open( lc_read_string( argc, argv, "--output", "-o" ), std::ios::out | std::ios::binary );
@@ -371,44 +279,87 @@
         }
 
         /* conversion mode */
-        if ( lc_read_flag( argc, argv, "--vertex-only", "-v" ) == false ) {
+        if ( dl_mode == false ) {
 
-            /* compute primitive count */
-            dl_face = dl_uv3_ply_primitive( dl_istream );
+            /* create temporary storage */
+            lc_temp_directory( lc_read_string( argc, argv, "--temporary", "-y" ), ( char * ) dl_path, LC_TEMP_CREATE );
 
-            /* export ply header */
-            dl_uv3_ply_header( dl_ostream, dl_vertex, dl_face );
+            /* compose face path */
+            dl_spill = std::string( ( char * ) dl_path ) + "/face";
 
-            /* export primitive */
-            dl_uv3_ply_vertex( dl_istream, dl_ostream );
+            /* create face stream */
+            dl_fstream.open( dl_spill, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary );
 
-            /* check primitive count */
-            if ( dl_face > 0 ) {
+            /* check face stream */
+            if ( dl_fstream.is_open() == false ) {
 
-                /* export primitive */
-                dl_uv3_ply_face( dl_istream, dl_ostream );
+                /* send message */
+                throw( LC_ERROR_IO_ACCESS );
 
             }
 
-        } else {
+        }
 
-            /* export ply header */
-            dl_uv3_ply_header( dl_ostream, dl_vertex, 0 );
+        /* export ply header placeholder */
+        dl_uv3_ply_header( dl_ostream, 0, 0 );
+
+        /* export vertex and spill faces */
+        dl_face = dl_uv3_ply_convert( dl_istream, dl_ostream, dl_mode == false ? & dl_fstream : nullptr, dl_vertex );
+
+        /* check consistency */
+        if ( dl_vertex == 0 ) {
+
+            /* send message */
+            throw( LC_ERROR_FORMAT );
+
+        }
+
+        /* conversion mode */
+        if ( dl_mode == false ) {
 
             /* export primitive */
-            dl_uv3_ply_vertex( dl_istream, dl_ostream );
+            dl_uv3_ply_spill( dl_fstream, dl_ostream );
+
+            /* delete face stream */
+            dl_fstream.close();
+
+            /* remove face stream */
+            std::remove( dl_spill.c_str() );
+
+            /* delete temporary storage */
+            lc_temp_directory( nullptr, ( char * ) dl_path, LC_TEMP_DELETE );
+
+            /* reset face path */
+            dl_spill.clear();
 
         }
 
+        /* rewind output stream */
+        dl_ostream.seekp( 0 );
+
+        /* export ply header */
+        dl_uv3_ply_header( dl_ostream, dl_vertex, dl_face );
+
         /* delete output stream */
         dl_ostream.close();
 
-        /* delete input stream */
-        dl_istream.close();
-
     /* error management */
     } catch ( int dl_code ) {
 
+        /* check temporary storage */
+        if ( dl_spill.empty() == false ) {
+
+            /* delete face stream */
+            dl_fstream.close();
+
+            /* remove face stream */
+            std::remove( dl_spill.c_str() );
+
+            /* remove temporary storage */
+            rmdir( ( char * ) dl_path );
+
+        }
+
         /* error management */
         lc_error( dl_code );
 
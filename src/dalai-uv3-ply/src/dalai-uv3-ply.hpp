@@ -54,7 +54,12 @@
 
     # include <iostream>
     # include <fstream>
+    # include <sstream>
+    # include <string>
+    # include <cstring>
+    # include <cstdio>
     # include <cstdint>
+    # include <unistd.h>
     # include <common-include.hpp>
     # include <eratosthene-include.h>
 
@@ -71,6 +76,9 @@
     /* define ply record */
     # define DL_PLY_FACE   ( sizeof( uint8_t ) + sizeof( int32_t ) * 3 )
 
+    /* define ply header length */
+    # define DL_PLY_HEADER ( 512 )
+
 /*
     header - preprocessor macros
  */
@@ -93,48 +101,49 @@
      *  according to the amount of vertex and faces that have to be written
      *  in the ply stream.
      *
+     *  The header is padded with a comment line in order to always occupy
+     *  DL_PLY_HEADER bytes. This allows to export a placeholder header before
+     *  the primitives are counted and to overwrite it once they are known.
+     *
      *  \param dl_stream PLY stream descriptor
      *  \param dl_vertex Vertex count
      *  \param dl_face   Face count
      */
 
-    le_void_t dl_uv3_ply_header( std::fstream & dl_stream, le_size_t const dl_vertex, le_size_t const dl_face );
-
-    /*! \brief statistical methods
-     *
-     *  This function reads the provided input streams and determine the amount
-     *  of points, lines and triangles. The function returns the total amount of
-     *  lines and triangles all considered as faces.
-     *
-     *  \param dl_stream UV3 stream descriptor
-     *
-     *  \return Returns total amount of faces in the uv3 stream
-     */
-
-    le_size_t dl_uv3_ply_primitive( std::fstream & dl_stream );
+    le_void_t dl_uv3_ply_header( std::ostream & dl_stream, le_size_t const dl_vertex, le_size_t const dl_face );
 
     /*! \brief conversion methods
      *
-     *  This function reads each record of the provided uv3 stream and export
-     *  its coordinates as a vertex in the provided ply stream.
+     *  This function reads each record of the provided uv3 stream, in a single
+     *  pass, and exports its coordinates as a vertex in the provided ply
+     *  stream. The amount of exported vertex is returned through the provided
+     *  vertex count.
+     *
+     *  If a face stream is provided, the lines and triangles detected in the
+     *  uv3 stream are exported in it as faces, the face stream then having to
+     *  be appended to the ply stream once all the vertex are exported. If a
+     *  null pointer is provided, the primitives are discarded.
      *
-     *  \param dl_istream UV3 stream descriptor
+     *  \param dl_istream UV3 stream reader
      *  \param dl_ostream PLY stream descriptor
+     *  \param dl_fstream Face stream descriptor
+     *  \param dl_vertex  Vertex count
+     *
+     *  \return Returns the amount of faces exported in the face stream
      */
 
-    le_void_t dl_uv3_ply_vertex( std::fstream & dl_istream, std::fstream & dl_ostream );
+    le_size_t dl_uv3_ply_convert( lc_uv3_t & dl_istream, std::ostream & dl_ostream, std::ostream * const dl_fstream, le_size_t & dl_vertex );
 
     /*! \brief conversion methods
      *
-     *  This function detects the lines and triangles present in the provided
-     *  uv3 stream and exports their definition in the provided output ply
-     *  stream as faces.
+     *  This function rewinds the provided face stream and appends its content
+     *  to the provided ply stream.
      *
-     *  \param dl_istream UV3 stream descriptor
+     *  \param dl_fstream Face stream descriptor
      *  \param dl_ostream PLY stream descriptor
      */
 
-    le_void_t dl_uv3_ply_face( std::fstream & dl_istream, std::fstream & dl_ostream );
+    le_void_t dl_uv3_ply_spill( std::istream & dl_fstream, std::ostream & dl_ostream );
 
     /*! \brief main methods
      *
@@ -144,15 +153,18 @@
      *      ./dalai-uv3-ply --input/-i [uv3 input file]
      *                      --output/-o [ply output file]
      *                      --vertex-only,-v [conversion switch]
-     *
-     *  The function starts by allocating the required i/o buffers memory and
-     *  creating the i/o streams. It then creates and exports the output ply
-     *  file header.
-     *
-     *  The function then starts by converting the vertex in the output ply
-     *  file before to export the faces, if present. If the 'vertex-only' switch
-     *  is specified, the main function only exports the vertex, i.e. the
-     *  points, in the output ply file, discarding faces.
+     *                      --temporary/-y [temporary storage path]
+     *
+     *  The function starts by creating the i/o streams and exports a header
+     *  placeholder in the output ply file. The input stream, which can be the
+     *  standard input, is then read only once.
+     *
+     *  The vertex are directly converted in the output ply file while the faces
+     *  are exported in a temporary file, created in the temporary storage path
+     *  or in /tmp by default. The temporary faces are then appended to the ply
+     *  file and the header is overwritten with the final primitives count. If
+     *  the 'vertex-only' switch is specified, the main function only exports
+     *  the vertex, i.e. the points, in the output ply file, discarding faces.
      *
      *  The created ply file is always considered in its binary representation
      *  and always considering little-endian byte order.